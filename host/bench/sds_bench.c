@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// SDS host benchmark
+//  Records a stream with the configured record size, measures write throughput and sdsWrite latency,
+//  then plays the stream back, verifies the content and measures read throughput.
+//  Exit code is 0 when the recorded stream is played back correctly (usable as playback regression).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "cmsis_os2.h"
+#include "sds.h"
+
+// Default parameters
+#define BENCH_STREAM_NAME       "bench"
+#define BENCH_RECORD_COUNT      100000U
+#define BENCH_RECORD_SIZE       256U
+#define BENCH_BUF_SIZE          (64U * 1024U)
+
+static uint32_t  rec_cnt  = BENCH_RECORD_COUNT;
+static uint32_t  rec_size = BENCH_RECORD_SIZE;
+static uint32_t  buf_size = BENCH_BUF_SIZE;
+static uint32_t  latency  = 0U;
+static uint32_t  channels = 0U;
+static uint32_t  record   = 1U;
+static uint32_t  playback = 1U;
+
+static uint8_t  *sds_buf;
+static uint8_t  *rec_buf;
+static uint32_t *lat_ns;
+
+// Monotonic time in nanoseconds.
+static uint64_t time_ns (void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+// Fill record with pattern derived from record number.
+//  With payload codec: slowly rising 16-bit samples (compressible by SDS_CODEC_DELTA16).
+static void rec_fill (uint8_t *buf, uint32_t size, uint32_t n) {
+  uint32_t i;
+
+  for (i = 0U; i < size; i++) {
+    if (channels != 0U) {
+      buf[i] = (uint8_t)(((n * 3U) + (i / 8U)) >> (((i & 1U) != 0U) ? 8U : 0U));
+    } else {
+      buf[i] = (uint8_t)((n * 31U) + (i * 7U));
+    }
+  }
+}
+
+// Compare function for qsort.
+static int cmp_u32 (const void *a, const void *b) {
+  uint32_t va = *(const uint32_t *)a;
+  uint32_t vb = *(const uint32_t *)b;
+
+  return (va > vb) - (va < vb);
+}
+
+// Print stream statistics.
+static void print_stats (sdsId_t id) {
+  sdsStats_t stats;
+
+  if (sdsGetStats(id, &stats) == SDS_OK) {
+    printf("  SDSIO transfers: %u, %u us total, buffer high-water mark %u of %u bytes\n",
+           stats.io_cnt, stats.io_time, stats.buf_max, stats.buf_size);
+  }
+}
+
+// Record stream.
+static int32_t bench_write (void) {
+  sdsId_t  id;
+  uint64_t start, t, total;
+  uint32_t n;
+  int32_t  ret;
+
+  if (channels != 0U) {
+    // Payload codec for 16-bit samples (used when supported by SDSIO-Client and SDSIO-Server).
+    id = sdsOpen(BENCH_STREAM_NAME, (sdsMode_t)(sdsModeWrite | SDS_CODEC_DELTA16(channels)), sds_buf, buf_size);
+  } else {
+    id = sdsOpen(BENCH_STREAM_NAME, sdsModeWrite, sds_buf, buf_size);
+  }
+  if (id == NULL) {
+    printf("Error: sdsOpen (write) failed\n");
+    return SDS_ERROR;
+  }
+  if (latency != 0U) {
+    sdsControl(id, SDS_CONTROL_LATENCY, latency);
+  }
+
+  start = time_ns();
+  for (n = 0U; n < rec_cnt; n++) {
+    rec_fill(rec_buf, rec_size, n);
+    t   = time_ns();
+    ret = sdsWriteTimeout(id, n, rec_buf, rec_size, osWaitForever);
+    lat_ns[n] = (uint32_t)(time_ns() - t);
+    if (ret != (int32_t)rec_size) {
+      printf("Error: sdsWrite failed (record %u, %d)\n", n, ret);
+      sdsClose(id);
+      return SDS_ERROR;
+    }
+  }
+  ret   = sdsFlush(id);
+  total = time_ns() - start;
+
+  printf("Write: %u records of %u bytes in %.3f ms: %.1f MB/s\n", rec_cnt, rec_size,
+         (double)total / 1e6, ((double)rec_cnt * (rec_size + 8U)) / ((double)total / 1e3));
+
+  qsort(lat_ns, rec_cnt, sizeof(uint32_t), cmp_u32);
+  printf("  sdsWrite latency: min %.2f us, median %.2f us, p99 %.2f us, max %.2f us\n",
+         lat_ns[0] / 1e3, lat_ns[rec_cnt / 2U] / 1e3, lat_ns[(rec_cnt * 99U) / 100U] / 1e3, lat_ns[rec_cnt - 1U] / 1e3);
+  print_stats(id);
+
+  if (ret != SDS_OK) {
+    printf("Error: sdsFlush failed (%d)\n", ret);
+  }
+  if (sdsClose(id) != SDS_OK) {
+    printf("Error: sdsClose (write) failed\n");
+    ret = SDS_ERROR;
+  }
+
+  return ret;
+}
+
+// Play back stream and verify content.
+static int32_t bench_read (void) {
+  sdsId_t  id;
+  uint64_t start, total;
+  uint32_t n, timeslot;
+  uint8_t *ref_buf;
+  int32_t  ret = SDS_OK;
+  int32_t  num;
+
+  ref_buf = malloc(rec_size);
+  if (ref_buf == NULL) {
+    return SDS_ERROR;
+  }
+
+  id = sdsOpen(BENCH_STREAM_NAME, sdsModeRead, sds_buf, buf_size);
+  if (id == NULL) {
+    printf("Error: sdsOpen (read) failed\n");
+    free(ref_buf);
+    return SDS_ERROR;
+  }
+
+  start = time_ns();
+  for (n = 0U; n < rec_cnt; n++) {
+    num = sdsReadTimeout(id, &timeslot, rec_buf, rec_size, osWaitForever);
+    rec_fill(ref_buf, rec_size, n);
+    if ((num != (int32_t)rec_size) || (timeslot != n) || (memcmp(rec_buf, ref_buf, rec_size) != 0)) {
+      printf("Error: record %u mismatch (%d)\n", n, num);
+      ret = SDS_ERROR;
+      break;
+    }
+  }
+  total = time_ns() - start;
+
+  if (ret == SDS_OK) {
+    num = sdsReadTimeout(id, &timeslot, rec_buf, rec_size, osWaitForever);
+    if (num != SDS_EOS) {
+      printf("Error: end of stream expected (%d)\n", num);
+      ret = SDS_ERROR;
+    }
+  }
+  if (ret == SDS_OK) {
+    printf("Read:  %u records of %u bytes in %.3f ms: %.1f MB/s\n", rec_cnt, rec_size,
+           (double)total / 1e6, ((double)rec_cnt * (rec_size + 8U)) / ((double)total / 1e3));
+    print_stats(id);
+  }
+
+  sdsClose(id);
+  free(ref_buf);
+
+  return ret;
+}
+
+static void usage (const char *prog) {
+  printf("Usage: %s [-n <records>] [-s <record size>] [-b <buffer size>] [-l <latency ticks>] [-c <channels>] [-w | -p]\n", prog);
+  printf("  -c  record with payload codec SDS_CODEC_DELTA16 (number of 16-bit channels, also for play back)\n");
+  printf("  -w  record only\n");
+  printf("  -p  play back only (stream recorded by a previous run)\n");
+}
+
+int main (int argc, char *argv[]) {
+  int32_t ret;
+  int     opt;
+
+  while ((opt = getopt(argc, argv, "n:s:b:l:c:wph")) != -1) {
+    switch (opt) {
+      case 'n': rec_cnt  = (uint32_t)strtoul(optarg, NULL, 0); break;
+      case 's': rec_size = (uint32_t)strtoul(optarg, NULL, 0); break;
+      case 'b': buf_size = (uint32_t)strtoul(optarg, NULL, 0); break;
+      case 'l': latency  = (uint32_t)strtoul(optarg, NULL, 0); break;
+      case 'c': channels = (uint32_t)strtoul(optarg, NULL, 0); break;
+      case 'w': playback = 0U; break;
+      case 'p': record   = 0U; break;
+      default:
+        usage(argv[0]);
+        return (opt == 'h') ? 0 : 1;
+    }
+  }
+  if ((rec_cnt == 0U) || (rec_size == 0U) || ((rec_size + 8U) > buf_size) || ((record | playback) == 0U) || (channels > 16U)) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  sds_buf = malloc(buf_size);
+  rec_buf = malloc(rec_size);
+  lat_ns  = malloc(rec_cnt * sizeof(uint32_t));
+  if ((sds_buf == NULL) || (rec_buf == NULL) || (lat_ns == NULL)) {
+    printf("Error: out of memory\n");
+    return 1;
+  }
+
+  if (record != 0U) {
+    // Start with a fresh recording (file system SDSIO interface writes to the working directory).
+    remove(BENCH_STREAM_NAME ".0.sds");
+  }
+
+  ret = sdsInit(NULL);
+  if (ret != SDS_OK) {
+    printf("Error: sdsInit failed (%d)\n", ret);
+    return 1;
+  }
+
+  if (record != 0U) {
+    ret = bench_write();
+  }
+  if ((ret == SDS_OK) && (playback != 0U)) {
+    // Play back the recorded stream (SDSIO-Server sets the playback flag when started with --playback).
+    sdsFlagsModify(SDS_FLAG_PLAYBACK, 0U);
+    ret = bench_read();
+  }
+
+  sdsUninit();
+
+  printf("%s\n", (ret == SDS_OK) ? "PASS" : "FAIL");
+
+  return (ret == SDS_OK) ? 0 : 1;
+}
@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// SDS buffer stress and throughput benchmark
+//  A producer thread writes a continuous byte sequence in chunks of pseudo-random size to an SDS buffer,
+//  a consumer thread reads it in chunks of pseudo-random size and verifies every byte.
+//  Producer and consumer run concurrently on separate cores when available (no locks, polling with sched_yield).
+//  Exit code is 0 when the consumer received the complete sequence without error.
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "sds.h"
+#include "sds_buffer.h"
+
+// Default parameters
+#define BENCH_TOTAL_SIZE        (1024U * 1024U * 1024U)
+#define BENCH_BUF_SIZE          (16U * 1024U)
+#define BENCH_CHUNK_SIZE        512U
+
+static uint32_t      total_size = BENCH_TOTAL_SIZE;
+static uint32_t      buf_size   = BENCH_BUF_SIZE;
+static uint32_t      chunk_size = BENCH_CHUNK_SIZE;
+static uint32_t      zero_copy  = 0U;
+
+static sdsBufferId_t buf_id;
+static uint8_t      *sds_buf;
+
+static atomic_uint   bench_abort;       // Set on error (stops producer and consumer)
+
+// Thread statistics
+typedef struct {
+  uint64_t calls;                       // Number of calls which transferred data
+  uint64_t retries;                     // Number of calls with full (producer) or empty (consumer) buffer
+  uint32_t error;                       // Position of first mismatch + 1 (consumer), 0 = no error
+} bench_stats_t;
+
+static bench_stats_t stats_prod;
+static bench_stats_t stats_cons;
+
+// Monotonic time in nanoseconds.
+static uint64_t time_ns (void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+// Pseudo-random chunk size (1 .. chunk_size).
+static uint32_t chunk_rand (uint32_t *state) {
+  uint32_t x = *state;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *state = x;
+
+  return (x % chunk_size) + 1U;
+}
+
+// Producer: write byte sequence (value = position modulo 251).
+static void *producer (void *arg) {
+  bench_stats_t    *stats = arg;
+  sdsBufferRegion_t region;
+  uint8_t          *chunk;
+  uint32_t          pos  = 0U;
+  uint32_t          seed = 0x12345678U;
+  uint32_t          size, i;
+  int32_t           num;
+
+  chunk = malloc(chunk_size);
+  if (chunk == NULL) {
+    atomic_store(&bench_abort, 1U);
+    return NULL;
+  }
+
+  while ((pos < total_size) && (atomic_load(&bench_abort) == 0U)) {
+    size = chunk_rand(&seed);
+    if (size > (total_size - pos)) {
+      size = total_size - pos;
+    }
+    if (zero_copy == 0U) {
+      for (i = 0U; i < size; i++) {
+        chunk[i] = (uint8_t)((pos + i) % 251U);
+      }
+      num = sdsBufferWrite(buf_id, chunk, size);
+      // Retry remaining part of the chunk until it is written.
+      while ((num < (int32_t)size) && (atomic_load(&bench_abort) == 0U)) {
+        if (num > 0) {
+          stats->calls++;
+          memmove(chunk, chunk + num, size - (uint32_t)num);
+          pos  += (uint32_t)num;
+          size -= (uint32_t)num;
+        } else {
+          stats->retries++;
+          sched_yield();
+        }
+        num = sdsBufferWrite(buf_id, chunk, size);
+      }
+    } else {
+      num = sdsBufferWriteAcquire(buf_id, 0U, size, &region);
+      if (num <= 0) {
+        if (atomic_load(&bench_abort) != 0U) {
+          break;
+        }
+        stats->retries++;
+        sched_yield();
+        continue;
+      }
+      size = (uint32_t)num;
+      for (i = 0U; i < region.size1; i++) {
+        region.buf1[i] = (uint8_t)((pos + i) % 251U);
+      }
+      for (i = 0U; i < region.size2; i++) {
+        region.buf2[i] = (uint8_t)((pos + region.size1 + i) % 251U);
+      }
+      sdsBufferWriteCommit(buf_id, size);
+    }
+    stats->calls++;
+    pos += size;
+  }
+
+  free(chunk);
+  return NULL;
+}
+
+// Consumer: read and verify byte sequence.
+static void *consumer (void *arg) {
+  bench_stats_t    *stats = arg;
+  sdsBufferRegion_t region;
+  uint8_t          *chunk;
+  uint32_t          pos  = 0U;
+  uint32_t          seed = 0x87654321U;
+  uint32_t          size, i;
+  int32_t           num;
+
+  chunk = malloc(chunk_size);
+  if (chunk == NULL) {
+    atomic_store(&bench_abort, 1U);
+    return NULL;
+  }
+
+  while ((pos < total_size) && (atomic_load(&bench_abort) == 0U)) {
+    size = chunk_rand(&seed);
+    if (zero_copy == 0U) {
+      num = sdsBufferRead(buf_id, chunk, size);
+      if (num <= 0) {
+        stats->retries++;
+        sched_yield();
+        continue;
+      }
+      for (i = 0U; i < (uint32_t)num; i++) {
+        if (chunk[i] != (uint8_t)((pos + i) % 251U)) {
+          break;
+        }
+      }
+    } else {
+      num = sdsBufferReadAcquire(buf_id, 0U, size, &region);
+      if (num <= 0) {
+        stats->retries++;
+        sched_yield();
+        continue;
+      }
+      for (i = 0U; i < region.size1; i++) {
+        if (region.buf1[i] != (uint8_t)((pos + i) % 251U)) {
+          break;
+        }
+      }
+      if (i == region.size1) {
+        for (; i < (uint32_t)num; i++) {
+          if (region.buf2[i - region.size1] != (uint8_t)((pos + i) % 251U)) {
+            break;
+          }
+        }
+      }
+      sdsBufferReadCommit(buf_id, (uint32_t)num);
+    }
+    if (i != (uint32_t)num) {
+      stats->error = pos + i + 1U;
+      atomic_store(&bench_abort, 1U);
+      break;
+    }
+    stats->calls++;
+    pos += (uint32_t)num;
+  }
+
+  free(chunk);
+  return NULL;
+}
+
+static void usage (const char *prog) {
+  printf("Usage: %s [-t <total size>] [-b <buffer size>] [-c <max chunk size>] [-z]\n", prog);
+  printf("  -z  use zero-copy functions (sdsBufferWriteAcquire/Commit, sdsBufferReadAcquire/Commit)\n");
+}
+
+int main (int argc, char *argv[]) {
+  pthread_t thread_prod, thread_cons;
+  uint64_t  start, total;
+  uint32_t  cnt_in, cnt_out;
+  int32_t   ret = SDS_OK;
+  int       opt;
+
+  while ((opt = getopt(argc, argv, "t:b:c:zh")) != -1) {
+    switch (opt) {
+      case 't': total_size = (uint32_t)strtoul(optarg, NULL, 0); break;
+      case 'b': buf_size   = (uint32_t)strtoul(optarg, NULL, 0); break;
+      case 'c': chunk_size = (uint32_t)strtoul(optarg, NULL, 0); break;
+      case 'z': zero_copy  = 1U; break;
+      default:
+        usage(argv[0]);
+        return (opt == 'h') ? 0 : 1;
+    }
+  }
+  if ((total_size == 0U) || (buf_size == 0U) || (chunk_size == 0U)) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  sds_buf = malloc(buf_size);
+  if (sds_buf == NULL) {
+    printf("Error: out of memory\n");
+    return 1;
+  }
+  buf_id = sdsBufferOpen(sds_buf, buf_size, 0U, 0U);
+  if (buf_id == NULL) {
+    printf("Error: sdsBufferOpen failed\n");
+    return 1;
+  }
+
+  start = time_ns();
+  if ((pthread_create(&thread_cons, NULL, consumer, &stats_cons) != 0) ||
+      (pthread_create(&thread_prod, NULL, producer, &stats_prod) != 0)) {
+    printf("Error: pthread_create failed\n");
+    return 1;
+  }
+  pthread_join(thread_prod, NULL);
+  pthread_join(thread_cons, NULL);
+  total = time_ns() - start;
+
+  sdsBufferGetCounters(buf_id, &cnt_in, &cnt_out);
+
+  printf("%s: %u bytes through %u byte buffer, chunks up to %u bytes, in %.3f ms: %.1f MB/s\n",
+         (zero_copy != 0U) ? "Zero-copy" : "Copy", total_size, buf_size, chunk_size,
+         (double)total / 1e6, (double)total_size / ((double)total / 1e3));
+  printf("  Producer: %llu writes, %llu retries (buffer full)\n",
+         (unsigned long long)stats_prod.calls, (unsigned long long)stats_prod.retries);
+  printf("  Consumer: %llu reads, %llu retries (buffer empty)\n",
+         (unsigned long long)stats_cons.calls, (unsigned long long)stats_cons.retries);
+  printf("  Buffer high-water mark: %d bytes\n", sdsBufferGetMaxCount(buf_id));
+
+  if (stats_cons.error != 0U) {
+    printf("Error: data mismatch at byte %u\n", stats_cons.error - 1U);
+    ret = SDS_ERROR;
+  } else if ((cnt_in != total_size) || (cnt_out != total_size)) {
+    printf("Error: counters mismatch (in %u, out %u)\n", cnt_in, cnt_out);
+    ret = SDS_ERROR;
+  }
+
+  sdsBufferClose(buf_id);
+  free(sds_buf);
+
+  printf("%s\n", (ret == SDS_OK) ? "PASS" : "FAIL");
+
+  return (ret == SDS_OK) ? 0 : 1;
+}
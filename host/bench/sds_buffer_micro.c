@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// SDS buffer microbenchmark
+//  Measures the time per call of the SDS buffer functions in a single thread for small transfer sizes,
+//  where the index handling dominates over the data copy.
+//  Built twice: sds_buffer_micro (SDS_BUFFER_POW2 = 0) and sds_buffer_micro_pow2 (SDS_BUFFER_POW2 = 1).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "sds.h"
+#include "sds_config.h"
+#include "sds_buffer.h"
+
+// Default parameters
+#define BENCH_ITERATIONS        10000000U
+#define BENCH_BUF_SIZE          4096U
+
+static uint32_t iterations = BENCH_ITERATIONS;
+static uint32_t buf_size   = BENCH_BUF_SIZE;
+
+static const uint32_t sizes[] = { 1U, 4U, 8U, 16U, 64U, 256U };
+
+static uint8_t  data_in[256];
+static uint8_t  data_out[256];
+
+// Monotonic time in nanoseconds.
+static uint64_t time_ns (void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+// sdsBufferWrite followed by sdsBufferRead.
+static double bench_copy (sdsBufferId_t id, uint32_t size) {
+  uint64_t start;
+  uint32_t n;
+
+  start = time_ns();
+  for (n = 0U; n < iterations; n++) {
+    sdsBufferWrite(id, data_in, size);
+    sdsBufferRead(id, data_out, size);
+  }
+  return (double)(time_ns() - start) / (2.0 * iterations);
+}
+
+// sdsBufferWriteAcquire/Commit followed by sdsBufferReadAcquire/Commit.
+static double bench_zero_copy (sdsBufferId_t id, uint32_t size) {
+  sdsBufferRegion_t region;
+  uint64_t          start;
+  uint32_t          n;
+
+  start = time_ns();
+  for (n = 0U; n < iterations; n++) {
+    sdsBufferWriteAcquire(id, 0U, size, &region);
+    sdsBufferWriteCommit(id, size);
+    sdsBufferReadAcquire(id, 0U, size, &region);
+    sdsBufferReadCommit(id, size);
+  }
+  return (double)(time_ns() - start) / (4.0 * iterations);
+}
+
+static void usage (const char *prog) {
+  printf("Usage: %s [-n <iterations>] [-b <buffer size>]\n", prog);
+}
+
+int main (int argc, char *argv[]) {
+  sdsBufferId_t id;
+  uint8_t      *buf;
+  uint32_t      i, cnt_in, cnt_out;
+  int           opt;
+
+  while ((opt = getopt(argc, argv, "n:b:h")) != -1) {
+    switch (opt) {
+      case 'n': iterations = (uint32_t)strtoul(optarg, NULL, 0); break;
+      case 'b': buf_size   = (uint32_t)strtoul(optarg, NULL, 0); break;
+      default:
+        usage(argv[0]);
+        return (opt == 'h') ? 0 : 1;
+    }
+  }
+  if ((iterations == 0U) || (buf_size < sizeof(data_in))) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  buf = malloc(buf_size);
+  if (buf == NULL) {
+    printf("Error: out of memory\n");
+    return 1;
+  }
+  id = sdsBufferOpen(buf, buf_size, 0U, 0U);
+  if (id == NULL) {
+    printf("Error: sdsBufferOpen failed (buffer size %u)\n", buf_size);
+    return 1;
+  }
+  memset(data_in, 0x55, sizeof(data_in));
+
+  printf("SDS_BUFFER_POW2 = %d, buffer size %u, %u iterations\n", SDS_BUFFER_POW2, buf_size, iterations);
+  printf("  Size    Write/Read    Acquire/Commit  [ns per call]\n");
+  for (i = 0U; i < (sizeof(sizes) / sizeof(sizes[0])); i++) {
+    printf("  %4u    %10.2f    %14.2f\n", sizes[i], bench_copy(id, sizes[i]), bench_zero_copy(id, sizes[i]));
+  }
+
+  // All written data has been read.
+  sdsBufferGetCounters(id, &cnt_in, &cnt_out);
+  sdsBufferClose(id);
+  free(buf);
+
+  return (cnt_in == cnt_out) ? 0 : 1;
+}
@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// SDSIO payload codec benchmark
+//  Encodes SDS streams of synthetic 16-bit sensor and audio records (record header and data) in commands
+//  as sent by SDSIO-Client, reports the compression ratio and the encode/decode time per byte
+//  and verifies the decoded stream.
+//  Exit code is 0 when all streams are decoded correctly.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "sds.h"
+#include "sdsio_codec.h"
+
+// Default parameters
+#define BENCH_DATA_SIZE         (1024U * 1024U)
+#define BENCH_RECORD_SIZE       240U
+#define BENCH_COMMAND_SIZE      8192U
+#define BENCH_PIECE_SIZE        1024U
+#define BENCH_ITERATIONS        20U
+
+static uint32_t data_size  = BENCH_DATA_SIZE;
+static uint32_t rec_size   = BENCH_RECORD_SIZE;
+static uint32_t cmd_size   = BENCH_COMMAND_SIZE;
+static uint32_t piece_size = BENCH_PIECE_SIZE;
+static uint32_t iterations = BENCH_ITERATIONS;
+static double   cpu_mhz    = 0.0;
+
+static int16_t *data_in;
+static uint8_t *stream;
+static uint8_t *data_enc;
+static uint8_t *data_out;
+static uint32_t stream_size;
+
+// Command as sent by SDSIO-Client
+typedef struct {
+  uint32_t size;                        // Size of stream data
+  uint32_t enc_size;                    // Size of encoded data (size: data is sent as is)
+} command_t;
+
+static command_t *commands;
+static uint32_t   command_cnt;
+
+// Signal
+typedef struct {
+  const char *name;
+  uint32_t    channels;
+  void      (*fill) (int16_t *buf, uint32_t cnt, uint32_t channels);
+} signal_t;
+
+// Monotonic time in nanoseconds.
+static uint64_t time_ns (void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+// Uniform noise in range -amplitude to +amplitude.
+static double noise (double amplitude) {
+  return amplitude * ((2.0 * ((double)rand() / (double)RAND_MAX)) - 1.0);
+}
+
+// Accelerometer: slow motion per axis, gravity on Z axis, sensor noise.
+static void fill_accel (int16_t *buf, uint32_t cnt, uint32_t channels) {
+  uint32_t n, ch;
+
+  for (n = 0U; n < (cnt / channels); n++) {
+    for (ch = 0U; ch < channels; ch++) {
+      buf[(n * channels) + ch] = (int16_t)lrint(((ch == 2U) ? 4096.0 : 0.0) +
+                                                (2000.0 * sin((double)n * 0.002 * (double)(ch + 1U))) + noise(8.0));
+    }
+  }
+}
+
+// Audio: mix of tones sampled at 16 kHz, background noise.
+static void fill_audio (int16_t *buf, uint32_t cnt, uint32_t channels) {
+  uint32_t n, ch;
+  double   t;
+
+  for (n = 0U; n < (cnt / channels); n++) {
+    t = (double)n / 16000.0;
+    for (ch = 0U; ch < channels; ch++) {
+      buf[(n * channels) + ch] = (int16_t)lrint((6000.0 * sin(2.0 * M_PI * 440.0 * t)) +
+                                                (3000.0 * sin(2.0 * M_PI * 1250.0 * t)) + noise(200.0));
+    }
+  }
+}
+
+// Random: incompressible data (sent as is by SDSIO-Client).
+static void fill_random (int16_t *buf, uint32_t cnt, uint32_t channels) {
+  uint32_t n;
+
+  (void)channels;
+  for (n = 0U; n < cnt; n++) {
+    buf[n] = (int16_t)(rand() & 0xFFFF);
+  }
+}
+
+static const signal_t signals[] = {
+  { "accelerometer (3 channels)", 3U, fill_accel  },
+  { "audio (1 channel)",          1U, fill_audio  },
+  { "audio (2 channels)",         2U, fill_audio  },
+  { "random (1 channel)",         1U, fill_random }
+};
+
+// Build SDS stream: records with header (timeslot, data size) and rec_size bytes of samples.
+static void build_stream (void) {
+  const uint8_t *in = (const uint8_t *)data_in;
+  uint32_t       head[2];
+  uint32_t       pos, size;
+
+  stream_size = 0U;
+  for (pos = 0U; pos < data_size; pos += size) {
+    size    = ((data_size - pos) < rec_size) ? (data_size - pos) : rec_size;
+    head[0] = pos / rec_size;
+    head[1] = size;
+    memcpy(&stream[stream_size], head, SDSIO_CODEC_HEAD_SIZE);
+    memcpy(&stream[stream_size + SDSIO_CODEC_HEAD_SIZE], &in[pos], size);
+    stream_size += SDSIO_CODEC_HEAD_SIZE + size;
+  }
+}
+
+// Encode stream in commands of up to cmd_size bytes as sent by SDSIO-Client, returns total size sent.
+//  The stream buffer wraps in the middle of each command at an odd offset (command data in two buffers).
+static uint32_t encode (uint32_t codec) {
+  sdsioCodecState_t state, state_next;
+  const uint8_t    *seg[2];
+  uint32_t          seg_size[2];
+  uint32_t          pos = 0U;
+  uint32_t          out = 0U;
+  uint32_t          size, left, num, enc_size, n;
+
+  sdsioCodecInit(&state, codec);
+  command_cnt = 0U;
+  while (pos < stream_size) {
+    size        = ((stream_size - pos) < cmd_size) ? (stream_size - pos) : cmd_size;
+    seg_size[0] = (size > 1U) ? ((size / 2U) | 1U) : size;
+    seg_size[1] = size - seg_size[0];
+    seg[0]      = &stream[pos];
+    seg[1]      = &stream[pos + seg_size[0]];
+
+    // Size of encoded data.
+    state_next = state;
+    enc_size   = 0U;
+    for (n = 0U; n < 2U; n++) {
+      num       = seg_size[n];
+      enc_size += sdsioCodecEncode(&state_next, seg[n], &num, NULL, 0U);
+    }
+    enc_size += sdsioCodecEncodeEnd(&state_next, NULL);
+
+    if (enc_size < size) {
+      // Encode in pieces of up to piece_size bytes.
+      left = size;
+      for (n = 0U; n < 2U; n++) {
+        while (seg_size[n] != 0U) {
+          num  = seg_size[n];
+          out += sdsioCodecEncode(&state, seg[n], &num, &data_enc[out], piece_size - 1U);
+          seg[n]      += num;
+          seg_size[n] -= num;
+          left        -= num;
+          if (left == 0U) {
+            out += sdsioCodecEncodeEnd(&state, &data_enc[out]);
+          }
+        }
+      }
+    } else {
+      // Send as is.
+      state    = state_next;
+      enc_size = size;
+      memcpy(&data_enc[out], &stream[pos], size);
+      out += size;
+    }
+    commands[command_cnt].size     = size;
+    commands[command_cnt].enc_size = enc_size;
+    command_cnt++;
+    pos += size;
+  }
+  return out;
+}
+
+// Decode commands, returns 0 when all commands are decoded.
+static int32_t decode (uint32_t codec) {
+  sdsioCodecState_t state;
+  uint32_t          in  = 0U;
+  uint32_t          pos = 0U;
+  uint32_t          num, n;
+
+  sdsioCodecInit(&state, codec);
+  for (n = 0U; n < command_cnt; n++) {
+    if (commands[n].enc_size < commands[n].size) {
+      if (sdsioCodecDecode(&state, &data_enc[in], commands[n].enc_size, &data_out[pos], commands[n].size) < 0) {
+        return SDS_ERROR;
+      }
+    } else {
+      // Data sent as is: update codec state.
+      memcpy(&data_out[pos], &data_enc[in], commands[n].size);
+      num = commands[n].size;
+      sdsioCodecEncode(&state, &data_out[pos], &num, NULL, 0U);
+      sdsioCodecEncodeEnd(&state, NULL);
+    }
+    in  += commands[n].enc_size;
+    pos += commands[n].size;
+  }
+  return SDS_OK;
+}
+
+static void usage (const char *prog) {
+  printf("Usage: %s [-s <data size>] [-r <record size>] [-c <command size>] [-p <piece size>] [-n <iterations>] [-f <CPU clock MHz>]\n", prog);
+}
+
+int main (int argc, char *argv[]) {
+  uint64_t start, t_enc, t_dec;
+  uint32_t codec, enc_size, as_is, i, n;
+  int32_t  ret = SDS_OK;
+  int      opt;
+
+  while ((opt = getopt(argc, argv, "s:r:c:p:n:f:h")) != -1) {
+    switch (opt) {
+      case 's': data_size  = (uint32_t)strtoul(optarg, NULL, 0); break;
+      case 'r': rec_size   = (uint32_t)strtoul(optarg, NULL, 0); break;
+      case 'c': cmd_size   = (uint32_t)strtoul(optarg, NULL, 0); break;
+      case 'p': piece_size = (uint32_t)strtoul(optarg, NULL, 0); break;
+      case 'n': iterations = (uint32_t)strtoul(optarg, NULL, 0); break;
+      case 'f': cpu_mhz    = strtod(optarg, NULL); break;
+      default:
+        usage(argv[0]);
+        return (opt == 'h') ? 0 : 1;
+    }
+  }
+  if ((data_size < 2U) || (rec_size == 0U) || (cmd_size == 0U) || (piece_size < 16U) || (iterations == 0U)) {
+    usage(argv[0]);
+    return 1;
+  }
+  data_size &= ~1U;
+
+  stream_size = data_size + (((data_size + rec_size - 1U) / rec_size) * SDSIO_CODEC_HEAD_SIZE);
+  data_in  = malloc(data_size);
+  stream   = malloc(stream_size);
+  data_enc = malloc(stream_size + piece_size);
+  data_out = malloc(stream_size);
+  commands = malloc(((stream_size / cmd_size) + 1U) * sizeof(command_t));
+  if ((data_in == NULL) || (stream == NULL) || (data_enc == NULL) || (data_out == NULL) || (commands == NULL)) {
+    printf("Error: out of memory\n");
+    return 1;
+  }
+
+  printf("SDSIO codec DELTA16, %u bytes in records of %u bytes, command size %u, piece size %u, %u iterations\n",
+         data_size, rec_size, cmd_size, piece_size, iterations);
+  printf("  Signal                        Ratio  As is    Encode      Decode  [ns per byte]");
+  printf((cpu_mhz != 0.0) ? "   Encode [cycles per byte]\n" : "\n");
+  for (i = 0U; i < (sizeof(signals) / sizeof(signals[0])); i++) {
+    codec = SDSIO_CODEC_TYPE_DELTA16 | ((signals[i].channels - 1U) << 4);
+    srand(1U);
+    signals[i].fill(data_in, data_size / 2U, signals[i].channels);
+    build_stream();
+
+    enc_size = 0U;
+    start = time_ns();
+    for (n = 0U; n < iterations; n++) {
+      enc_size = encode(codec);
+    }
+    t_enc = time_ns() - start;
+
+    memset(data_out, 0, stream_size);
+    start = time_ns();
+    for (n = 0U; n < iterations; n++) {
+      if (decode(codec) != SDS_OK) {
+        break;
+      }
+    }
+    t_dec = time_ns() - start;
+
+    if ((n != iterations) || (memcmp(stream, data_out, stream_size) != 0)) {
+      printf("  %-28s  decoded data mismatch\n", signals[i].name);
+      ret = SDS_ERROR;
+      continue;
+    }
+    as_is = 0U;
+    for (n = 0U; n < command_cnt; n++) {
+      if (commands[n].enc_size == commands[n].size) {
+        as_is++;
+      }
+    }
+    printf("  %-28s  %5.2f  %4u%%  %8.3f    %8.3f", signals[i].name,
+           (double)stream_size / (double)enc_size,
+           (100U * as_is) / command_cnt,
+           (double)t_enc / ((double)stream_size * iterations),
+           (double)t_dec / ((double)stream_size * iterations));
+    if (cpu_mhz != 0.0) {
+      printf("                %8.2f", ((double)t_enc * cpu_mhz) / (1000.0 * (double)stream_size * iterations));
+    }
+    printf("\n");
+  }
+
+  free(data_in);
+  free(stream);
+  free(data_enc);
+  free(data_out);
+  free(commands);
+
+  printf("%s\n", (ret == SDS_OK) ? "PASS" : "FAIL");
+
+  return (ret == SDS_OK) ? 0 : 1;
+}
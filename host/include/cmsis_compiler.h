@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CMSIS-Compiler subset used by the SDS-Framework (host port, GCC and Clang)
+
+#ifndef CMSIS_COMPILER_H
+#define CMSIS_COMPILER_H
+
+#include <stdint.h>
+
+#ifndef   __STATIC_INLINE
+  #define __STATIC_INLINE                        static inline
+#endif
+#ifndef   __STATIC_FORCEINLINE
+  #define __STATIC_FORCEINLINE                   __attribute__((always_inline)) static inline
+#endif
+#ifndef   __NO_RETURN
+  #define __NO_RETURN                            __attribute__((__noreturn__))
+#endif
+#ifndef   __WEAK
+  #define __WEAK                                 __attribute__((weak))
+#endif
+#ifndef   __ALIGNED
+  #define __ALIGNED(x)                           __attribute__((aligned(x)))
+#endif
+#ifndef   __PACKED
+  #define __PACKED                               __attribute__((packed, aligned(1)))
+#endif
+
+// Memory barriers (full memory fence on the host).
+#define __DMB()                                  __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __DSB()                                  __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __ISB()                                  __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+// Interrupt masking is emulated by a global lock (see host/rtos2/os2_posix.c).
+//  Used only by the fallback atomic operations when C11 atomics are not available.
+extern uint32_t __get_PRIMASK (void);
+extern void     __disable_irq (void);
+extern void     __enable_irq  (void);
+
+#endif  // CMSIS_COMPILER_H
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CMSIS-RTOS2 API subset used by the SDS-Framework (host port)
+//  Declarations are compatible with the CMSIS-RTOS2 API (cmsis_os2.h).
+//  Only the functions used by SDS, SDSIO and SDSIO-Client are provided (see host/rtos2/os2_posix.c).
+
+#ifndef CMSIS_OS2_H_
+#define CMSIS_OS2_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/// Status code values returned by CMSIS-RTOS functions.
+typedef enum {
+  osOK                      =  0,         ///< Operation completed successfully.
+  osError                   = -1,         ///< Unspecified RTOS error: run-time error but no other error message fits.
+  osErrorTimeout            = -2,         ///< Operation not completed within the timeout period.
+  osErrorResource           = -3,         ///< Resource not available.
+  osErrorParameter          = -4,         ///< Parameter error.
+  osErrorNoMemory           = -5,         ///< System is out of memory: it was impossible to allocate or reserve memory for the operation.
+  osErrorISR                = -6,         ///< Not allowed in ISR context: the function cannot be called from interrupt service routines.
+  osStatusReserved          = 0x7FFFFFFF  ///< Prevents enum down-size compiler optimization.
+} osStatus_t;
+
+/// Priority values.
+typedef enum {
+  osPriorityNone            =  0,         ///< No priority (not initialized).
+  osPriorityIdle            =  1,         ///< Reserved for Idle thread.
+  osPriorityLow             =  8,         ///< Priority: low
+  osPriorityBelowNormal     = 16,         ///< Priority: below normal
+  osPriorityNormal          = 24,         ///< Priority: normal
+  osPriorityAboveNormal     = 32,         ///< Priority: above normal
+  osPriorityHigh            = 40,         ///< Priority: high
+  osPriorityRealtime        = 48,         ///< Priority: realtime
+  osPriorityISR             = 56,         ///< Reserved for ISR deferred thread.
+  osPriorityError           = -1,         ///< System cannot determine priority or illegal priority.
+  osPriorityReserved        = 0x7FFFFFFF  ///< Prevents enum down-size compiler optimization.
+} osPriority_t;
+
+/// Entry point of a thread.
+typedef void (*osThreadFunc_t) (void *argument);
+
+/// Object identifiers.
+typedef void *osThreadId_t;
+typedef void *osEventFlagsId_t;
+typedef void *osMutexId_t;
+typedef void *osSemaphoreId_t;
+
+/// Timeout value.
+#define osWaitForever         0xFFFFFFFFU ///< Wait forever timeout value.
+
+/// Flags options (\ref osThreadFlagsWait and \ref osEventFlagsWait).
+#define osFlagsWaitAny        0x00000000U ///< Wait for any flag (default).
+#define osFlagsWaitAll        0x00000001U ///< Wait for all flags.
+#define osFlagsNoClear        0x00000002U ///< Do not clear flags which have been specified to wait for.
+
+/// Flags errors (returned by osThreadFlagsXxxx and osEventFlagsXxxx).
+#define osFlagsError          0x80000000U ///< Error indicator.
+#define osFlagsErrorUnknown   0xFFFFFFFFU ///< osError (-1).
+#define osFlagsErrorTimeout   0xFFFFFFFEU ///< osErrorTimeout (-2).
+#define osFlagsErrorResource  0xFFFFFFFDU ///< osErrorResource (-3).
+#define osFlagsErrorParameter 0xFFFFFFFCU ///< osErrorParameter (-4).
+#define osFlagsErrorISR       0xFFFFFFFAU ///< osErrorISR (-6).
+
+/// Thread attributes (attr_bits in \ref osThreadAttr_t).
+#define osThreadDetached      0x00000000U ///< Thread created in detached mode (default)
+#define osThreadJoinable      0x00000001U ///< Thread created in joinable mode
+
+/// Attributes structure for thread.
+typedef struct {
+  const char                   *name;   ///< name of the thread
+  uint32_t                 attr_bits;   ///< attribute bits
+  void                      *cb_mem;    ///< memory for control block
+  uint32_t                   cb_size;   ///< size of provided memory for control block
+  void                   *stack_mem;    ///< memory for stack
+  uint32_t                stack_size;   ///< size of stack
+  osPriority_t              priority;   ///< initial thread priority (default: osPriorityNormal)
+  uint32_t                 tz_module;   ///< TrustZone module identifier
+  uint32_t                  reserved;   ///< reserved (must be 0)
+} osThreadAttr_t;
+
+/// Attributes structure for event flags.
+typedef struct {
+  const char                   *name;   ///< name of the event flags
+  uint32_t                 attr_bits;   ///< attribute bits
+  void                      *cb_mem;    ///< memory for control block
+  uint32_t                   cb_size;   ///< size of provided memory for control block
+} osEventFlagsAttr_t;
+
+/// Attributes structure for mutex.
+typedef struct {
+  const char                   *name;   ///< name of the mutex
+  uint32_t                 attr_bits;   ///< attribute bits
+  void                      *cb_mem;    ///< memory for control block
+  uint32_t                   cb_size;   ///< size of provided memory for control block
+} osMutexAttr_t;
+
+/// Attributes structure for semaphore.
+typedef struct {
+  const char                   *name;   ///< name of the semaphore
+  uint32_t                 attr_bits;   ///< attribute bits
+  void                      *cb_mem;    ///< memory for control block
+  uint32_t                   cb_size;   ///< size of provided memory for control block
+} osSemaphoreAttr_t;
+
+
+//  ==== Kernel Management Functions ====
+
+osStatus_t       osKernelInitialize (void);
+osStatus_t       osKernelStart (void);
+uint32_t         osKernelGetTickCount (void);
+uint32_t         osKernelGetTickFreq (void);
+uint32_t         osKernelGetSysTimerCount (void);
+uint32_t         osKernelGetSysTimerFreq (void);
+
+//  ==== Thread Management Functions ====
+
+osThreadId_t     osThreadNew (osThreadFunc_t func, void *argument, const osThreadAttr_t *attr);
+osThreadId_t     osThreadGetId (void);
+osStatus_t       osThreadTerminate (osThreadId_t thread_id);
+#if defined(__GNUC__)
+__attribute__((__noreturn__))
+#endif
+void             osThreadExit (void);
+
+//  ==== Thread Flags Functions ====
+
+uint32_t         osThreadFlagsSet (osThreadId_t thread_id, uint32_t flags);
+uint32_t         osThreadFlagsClear (uint32_t flags);
+uint32_t         osThreadFlagsWait (uint32_t flags, uint32_t options, uint32_t timeout);
+
+//  ==== Generic Wait Functions ====
+
+osStatus_t       osDelay (uint32_t ticks);
+osStatus_t       osDelayUntil (uint32_t ticks);
+
+//  ==== Event Flags Management Functions ====
+
+osEventFlagsId_t osEventFlagsNew (const osEventFlagsAttr_t *attr);
+uint32_t         osEventFlagsSet (osEventFlagsId_t ef_id, uint32_t flags);
+uint32_t         osEventFlagsClear (osEventFlagsId_t ef_id, uint32_t flags);
+uint32_t         osEventFlagsGet (osEventFlagsId_t ef_id);
+uint32_t         osEventFlagsWait (osEventFlagsId_t ef_id, uint32_t flags, uint32_t options, uint32_t timeout);
+osStatus_t       osEventFlagsDelete (osEventFlagsId_t ef_id);
+
+//  ==== Mutex Management Functions ====
+
+osMutexId_t      osMutexNew (const osMutexAttr_t *attr);
+osStatus_t       osMutexAcquire (osMutexId_t mutex_id, uint32_t timeout);
+osStatus_t       osMutexRelease (osMutexId_t mutex_id);
+osStatus_t       osMutexDelete (osMutexId_t mutex_id);
+
+//  ==== Semaphore Management Functions ====
+
+osSemaphoreId_t  osSemaphoreNew (uint32_t max_count, uint32_t initial_count, const osSemaphoreAttr_t *attr);
+osStatus_t       osSemaphoreAcquire (osSemaphoreId_t semaphore_id, uint32_t timeout);
+osStatus_t       osSemaphoreRelease (osSemaphoreId_t semaphore_id);
+osStatus_t       osSemaphoreDelete (osSemaphoreId_t semaphore_id);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  // CMSIS_OS2_H_
@@ -0,0 +1,575 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CMSIS-RTOS2 API subset on POSIX threads (host port)
+//  Kernel tick:  1 ms (CLOCK_MONOTONIC)
+//  System timer: 1 GHz (CLOCK_MONOTONIC, 32-bit nanosecond counter)
+//  Thread priorities and stack sizes are not applied: all threads are scheduled by the host OS.
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "cmsis_compiler.h"
+#include "cmsis_os2.h"
+
+// Thread control block
+typedef struct {
+  pthread_t        thread;              // POSIX thread
+  osThreadFunc_t   func;                // Thread function
+  void            *argument;            // Thread function argument
+  pthread_mutex_t  mutex;               // Mutex protecting thread flags
+  pthread_cond_t   cond;                // Condition signaled when thread flags are set
+  uint32_t         flags;               // Thread flags
+} os_thread_t;
+
+// Object control block (event flags, mutex, semaphore)
+typedef struct {
+  pthread_mutex_t  mutex;               // Mutex protecting object state
+  pthread_cond_t   cond;                // Condition signaled when object state changes
+  uint32_t         value;               // Event flags value or semaphore count
+  uint32_t         max;                 // Maximum semaphore count
+  pthread_t        owner;               // Mutex owner thread
+  uint32_t         lock_cnt;            // Mutex lock counter (recursive mutex)
+} os_object_t;
+
+// Control block of the calling thread (allocated on first use for threads not created by osThreadNew)
+static __thread os_thread_t *os_thread_self = NULL;
+
+// Interrupt masking emulation (global lock)
+static pthread_mutex_t       os_irq_lock    = PTHREAD_MUTEX_INITIALIZER;
+static __thread uint32_t     os_irq_masked  = 0U;
+
+// Helper functions
+
+// Get absolute CLOCK_MONOTONIC time after timeout in ticks.
+static struct timespec os_abstime (uint32_t ticks) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  ts.tv_sec  += ticks / 1000U;
+  ts.tv_nsec += (long)(ticks % 1000U) * 1000000L;
+  if (ts.tv_nsec >= 1000000000L) {
+    ts.tv_sec++;
+    ts.tv_nsec -= 1000000000L;
+  }
+
+  return ts;
+}
+
+// Initialize condition variable using CLOCK_MONOTONIC for timed waits.
+static void os_cond_init (pthread_cond_t *cond) {
+  pthread_condattr_t attr;
+
+  pthread_condattr_init(&attr);
+  pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+  pthread_cond_init(cond, &attr);
+  pthread_condattr_destroy(&attr);
+}
+
+// Unlock mutex (cleanup handler for cancelled threads).
+static void os_unlock_cleanup (void *arg) {
+  pthread_mutex_unlock((pthread_mutex_t *)arg);
+}
+
+// Wait on condition variable.
+//  Return: 0 when signaled or ETIMEDOUT when timeout expired.
+static int os_cond_wait (pthread_cond_t *cond, pthread_mutex_t *mutex, uint32_t timeout, const struct timespec *abstime) {
+  int err;
+
+  if (timeout == 0U) {
+    err = ETIMEDOUT;
+  } else if (timeout == osWaitForever) {
+    err = pthread_cond_wait(cond, mutex);
+  } else {
+    err = pthread_cond_timedwait(cond, mutex, abstime);
+  }
+
+  return err;
+}
+
+// Wait for flags (thread flags or event flags).
+static uint32_t os_flags_wait (pthread_mutex_t *mutex, pthread_cond_t *cond, uint32_t *value,
+                               uint32_t flags, uint32_t options, uint32_t timeout) {
+  struct timespec abstime;
+  uint32_t        ret;
+  int             err = 0;
+
+  abstime = os_abstime((timeout == osWaitForever) ? 0U : timeout);
+
+  pthread_mutex_lock(mutex);
+  pthread_cleanup_push(os_unlock_cleanup, mutex);
+  while (1) {
+    ret = *value;
+    if ((((options & osFlagsWaitAll) != 0U) && ((ret & flags) == flags)) ||
+        (((options & osFlagsWaitAll) == 0U) && ((ret & flags) != 0U))) {
+      if ((options & osFlagsNoClear) == 0U) {
+        *value &= ~flags;
+      }
+      break;
+    }
+    if (err != 0) {
+      ret = (timeout == 0U) ? osFlagsErrorResource : osFlagsErrorTimeout;
+      break;
+    }
+    err = os_cond_wait(cond, mutex, timeout, &abstime);
+  }
+  pthread_cleanup_pop(1);
+
+  return ret;
+}
+
+// Allocate thread control block.
+static os_thread_t *os_thread_alloc (void) {
+  os_thread_t *thread;
+
+  thread = calloc(1U, sizeof(os_thread_t));
+  if (thread != NULL) {
+    pthread_mutex_init(&thread->mutex, NULL);
+    os_cond_init(&thread->cond);
+  }
+
+  return thread;
+}
+
+// Thread entry (POSIX thread start routine).
+static void *os_thread_entry (void *arg) {
+  os_thread_t *thread = arg;
+
+  os_thread_self = thread;
+  thread->func(thread->argument);
+
+  return NULL;
+}
+
+// Allocate object control block.
+static os_object_t *os_object_new (uint32_t value, uint32_t max) {
+  os_object_t *obj;
+
+  obj = calloc(1U, sizeof(os_object_t));
+  if (obj != NULL) {
+    pthread_mutex_init(&obj->mutex, NULL);
+    os_cond_init(&obj->cond);
+    obj->value = value;
+    obj->max   = max;
+  }
+
+  return obj;
+}
+
+// Delete object control block.
+static osStatus_t os_object_delete (void *id) {
+  os_object_t *obj = id;
+
+  if (obj == NULL) {
+    return osErrorParameter;
+  }
+  pthread_cond_destroy(&obj->cond);
+  pthread_mutex_destroy(&obj->mutex);
+  free(obj);
+
+  return osOK;
+}
+
+// Interrupt masking emulation
+
+uint32_t __get_PRIMASK (void) {
+  return os_irq_masked;
+}
+
+void __disable_irq (void) {
+  if (os_irq_masked == 0U) {
+    pthread_mutex_lock(&os_irq_lock);
+    os_irq_masked = 1U;
+  }
+}
+
+void __enable_irq (void) {
+  if (os_irq_masked != 0U) {
+    os_irq_masked = 0U;
+    pthread_mutex_unlock(&os_irq_lock);
+  }
+}
+
+//  ==== Kernel Management Functions ====
+
+osStatus_t osKernelInitialize (void) {
+  return osOK;
+}
+
+osStatus_t osKernelStart (void) {
+  // Threads are already running: block the calling (main) thread.
+  while (1) {
+    pause();
+  }
+}
+
+uint32_t osKernelGetTickCount (void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)(((uint64_t)ts.tv_sec * 1000U) + ((uint64_t)ts.tv_nsec / 1000000U));
+}
+
+uint32_t osKernelGetTickFreq (void) {
+  return 1000U;
+}
+
+uint32_t osKernelGetSysTimerCount (void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)(((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec);
+}
+
+uint32_t osKernelGetSysTimerFreq (void) {
+  return 1000000000U;
+}
+
+//  ==== Thread Management Functions ====
+
+osThreadId_t osThreadNew (osThreadFunc_t func, void *argument, const osThreadAttr_t *attr) {
+  os_thread_t   *thread;
+  pthread_attr_t pattr;
+  int            err;
+
+  (void)attr;
+
+  if (func == NULL) {
+    return NULL;
+  }
+  thread = os_thread_alloc();
+  if (thread == NULL) {
+    return NULL;
+  }
+  thread->func     = func;
+  thread->argument = argument;
+
+  pthread_attr_init(&pattr);
+  pthread_attr_setdetachstate(&pattr, PTHREAD_CREATE_DETACHED);
+  err = pthread_create(&thread->thread, &pattr, os_thread_entry, thread);
+  pthread_attr_destroy(&pattr);
+  if (err != 0) {
+    pthread_cond_destroy(&thread->cond);
+    pthread_mutex_destroy(&thread->mutex);
+    free(thread);
+    return NULL;
+  }
+
+  return thread;
+}
+
+osThreadId_t osThreadGetId (void) {
+
+  if (os_thread_self == NULL) {
+    // Thread not created by osThreadNew (for example main thread).
+    os_thread_self = os_thread_alloc();
+    if (os_thread_self != NULL) {
+      os_thread_self->thread = pthread_self();
+    }
+  }
+
+  return os_thread_self;
+}
+
+osStatus_t osThreadTerminate (osThreadId_t thread_id) {
+  os_thread_t *thread = thread_id;
+
+  if (thread == NULL) {
+    return osErrorParameter;
+  }
+  if (thread == os_thread_self) {
+    osThreadExit();
+  }
+  if (pthread_cancel(thread->thread) != 0) {
+    return osErrorResource;
+  }
+
+  return osOK;
+}
+
+void osThreadExit (void) {
+  pthread_exit(NULL);
+}
+
+//  ==== Thread Flags Functions ====
+
+uint32_t osThreadFlagsSet (osThreadId_t thread_id, uint32_t flags) {
+  os_thread_t *thread = thread_id;
+  uint32_t     ret;
+
+  if ((thread == NULL) || ((flags & osFlagsError) != 0U)) {
+    return osFlagsErrorParameter;
+  }
+  pthread_mutex_lock(&thread->mutex);
+  thread->flags |= flags;
+  ret = thread->flags;
+  pthread_cond_broadcast(&thread->cond);
+  pthread_mutex_unlock(&thread->mutex);
+
+  return ret;
+}
+
+uint32_t osThreadFlagsClear (uint32_t flags) {
+  os_thread_t *thread = osThreadGetId();
+  uint32_t     ret;
+
+  if (thread == NULL) {
+    return osFlagsErrorUnknown;
+  }
+  pthread_mutex_lock(&thread->mutex);
+  ret = thread->flags;
+  thread->flags &= ~flags;
+  pthread_mutex_unlock(&thread->mutex);
+
+  return ret;
+}
+
+uint32_t osThreadFlagsWait (uint32_t flags, uint32_t options, uint32_t timeout) {
+  os_thread_t *thread = osThreadGetId();
+
+  if (thread == NULL) {
+    return osFlagsErrorUnknown;
+  }
+
+  return os_flags_wait(&thread->mutex, &thread->cond, &thread->flags, flags, options, timeout);
+}
+
+//  ==== Generic Wait Functions ====
+
+osStatus_t osDelay (uint32_t ticks) {
+  struct timespec ts;
+
+  ts.tv_sec  = ticks / 1000U;
+  ts.tv_nsec = (long)(ticks % 1000U) * 1000000L;
+  while (nanosleep(&ts, &ts) != 0) {
+    // Interrupted by signal: sleep for the remaining time.
+  }
+
+  return osOK;
+}
+
+osStatus_t osDelayUntil (uint32_t ticks) {
+  uint32_t delay;
+
+  delay = ticks - osKernelGetTickCount();
+  if (delay >= 0x80000000U) {
+    // Tick count is already in the past.
+    return osErrorParameter;
+  }
+
+  return osDelay(delay);
+}
+
+//  ==== Event Flags Management Functions ====
+
+osEventFlagsId_t osEventFlagsNew (const osEventFlagsAttr_t *attr) {
+  (void)attr;
+  return os_object_new(0U, 0U);
+}
+
+uint32_t osEventFlagsSet (osEventFlagsId_t ef_id, uint32_t flags) {
+  os_object_t *obj = ef_id;
+  uint32_t     ret;
+
+  if ((obj == NULL) || ((flags & osFlagsError) != 0U)) {
+    return osFlagsErrorParameter;
+  }
+  pthread_mutex_lock(&obj->mutex);
+  obj->value |= flags;
+  ret = obj->value;
+  pthread_cond_broadcast(&obj->cond);
+  pthread_mutex_unlock(&obj->mutex);
+
+  return ret;
+}
+
+uint32_t osEventFlagsClear (osEventFlagsId_t ef_id, uint32_t flags) {
+  os_object_t *obj = ef_id;
+  uint32_t     ret;
+
+  if ((obj == NULL) || ((flags & osFlagsError) != 0U)) {
+    return osFlagsErrorParameter;
+  }
+  pthread_mutex_lock(&obj->mutex);
+  ret = obj->value;
+  obj->value &= ~flags;
+  pthread_mutex_unlock(&obj->mutex);
+
+  return ret;
+}
+
+uint32_t osEventFlagsGet (osEventFlagsId_t ef_id) {
+  os_object_t *obj = ef_id;
+  uint32_t     ret;
+
+  if (obj == NULL) {
+    return 0U;
+  }
+  pthread_mutex_lock(&obj->mutex);
+  ret = obj->value;
+  pthread_mutex_unlock(&obj->mutex);
+
+  return ret;
+}
+
+uint32_t osEventFlagsWait (osEventFlagsId_t ef_id, uint32_t flags, uint32_t options, uint32_t timeout) {
+  os_object_t *obj = ef_id;
+
+  if ((obj == NULL) || ((flags & osFlagsError) != 0U)) {
+    return osFlagsErrorParameter;
+  }
+
+  return os_flags_wait(&obj->mutex, &obj->cond, &obj->value, flags, options, timeout);
+}
+
+osStatus_t osEventFlagsDelete (osEventFlagsId_t ef_id) {
+  return os_object_delete(ef_id);
+}
+
+//  ==== Mutex Management Functions ====
+
+osMutexId_t osMutexNew (const osMutexAttr_t *attr) {
+  (void)attr;
+  return os_object_new(0U, 0U);
+}
+
+osStatus_t osMutexAcquire (osMutexId_t mutex_id, uint32_t timeout) {
+  os_object_t    *obj = mutex_id;
+  struct timespec abstime;
+  osStatus_t      ret = osOK;
+  int             err = 0;
+
+  if (obj == NULL) {
+    return osErrorParameter;
+  }
+  abstime = os_abstime((timeout == osWaitForever) ? 0U : timeout);
+
+  pthread_mutex_lock(&obj->mutex);
+  pthread_cleanup_push(os_unlock_cleanup, &obj->mutex);
+  while (1) {
+    if ((obj->lock_cnt == 0U) || (pthread_equal(obj->owner, pthread_self()) != 0)) {
+      obj->owner = pthread_self();
+      obj->lock_cnt++;
+      break;
+    }
+    if (err != 0) {
+      ret = (timeout == 0U) ? osErrorResource : osErrorTimeout;
+      break;
+    }
+    err = os_cond_wait(&obj->cond, &obj->mutex, timeout, &abstime);
+  }
+  pthread_cleanup_pop(1);
+
+  return ret;
+}
+
+osStatus_t osMutexRelease (osMutexId_t mutex_id) {
+  os_object_t *obj = mutex_id;
+  osStatus_t   ret = osOK;
+
+  if (obj == NULL) {
+    return osErrorParameter;
+  }
+  pthread_mutex_lock(&obj->mutex);
+  if ((obj->lock_cnt == 0U) || (pthread_equal(obj->owner, pthread_self()) == 0)) {
+    ret = osErrorResource;
+  } else {
+    obj->lock_cnt--;
+    if (obj->lock_cnt == 0U) {
+      pthread_cond_broadcast(&obj->cond);
+    }
+  }
+  pthread_mutex_unlock(&obj->mutex);
+
+  return ret;
+}
+
+osStatus_t osMutexDelete (osMutexId_t mutex_id) {
+  return os_object_delete(mutex_id);
+}
+
+//  ==== Semaphore Management Functions ====
+
+osSemaphoreId_t osSemaphoreNew (uint32_t max_count, uint32_t initial_count, const osSemaphoreAttr_t *attr) {
+  (void)attr;
+
+  if ((max_count == 0U) || (initial_count > max_count)) {
+    return NULL;
+  }
+
+  return os_object_new(initial_count, max_count);
+}
+
+osStatus_t osSemaphoreAcquire (osSemaphoreId_t semaphore_id, uint32_t timeout) {
+  os_object_t    *obj = semaphore_id;
+  struct timespec abstime;
+  osStatus_t      ret = osOK;
+  int             err = 0;
+
+  if (obj == NULL) {
+    return osErrorParameter;
+  }
+  abstime = os_abstime((timeout == osWaitForever) ? 0U : timeout);
+
+  pthread_mutex_lock(&obj->mutex);
+  pthread_cleanup_push(os_unlock_cleanup, &obj->mutex);
+  while (1) {
+    if (obj->value != 0U) {
+      obj->value--;
+      break;
+    }
+    if (err != 0) {
+      ret = (timeout == 0U) ? osErrorResource : osErrorTimeout;
+      break;
+    }
+    err = os_cond_wait(&obj->cond, &obj->mutex, timeout, &abstime);
+  }
+  pthread_cleanup_pop(1);
+
+  return ret;
+}
+
+osStatus_t osSemaphoreRelease (osSemaphoreId_t semaphore_id) {
+  os_object_t *obj = semaphore_id;
+  osStatus_t   ret = osOK;
+
+  if (obj == NULL) {
+    return osErrorParameter;
+  }
+  pthread_mutex_lock(&obj->mutex);
+  if (obj->value < obj->max) {
+    obj->value++;
+    pthread_cond_broadcast(&obj->cond);
+  } else {
+    ret = osErrorResource;
+  }
+  pthread_mutex_unlock(&obj->mutex);
+
+  return ret;
+}
+
+osStatus_t osSemaphoreDelete (osSemaphoreId_t semaphore_id) {
+  return os_object_delete(semaphore_id);
+}
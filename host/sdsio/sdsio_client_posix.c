@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// SDSIO-Client via POSIX Socket (host port)
+//  Connects to 'sdsio-server.py socket'. Server address can be overridden with the
+//  environment variables SDSIO_SERVER_IP and SDSIO_SERVER_PORT.
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/uio.h>
+
+#include "cmsis_os2.h"
+
+#include "sds.h"
+#include "sdsio_client.h"
+
+// SDSIO-Server IPv4 address
+#ifndef SDSIO_SOCKET_SERVER_IP
+#define SDSIO_SOCKET_SERVER_IP          "127.0.0.1"
+#endif
+
+// SDSIO-Server port
+#ifndef SDSIO_SOCKET_SERVER_PORT
+#define SDSIO_SOCKET_SERVER_PORT        5050U
+#endif
+
+// Socket transfer timeout in kernel ticks (ms)
+#ifndef SDSIO_SOCKET_TIMEOUT
+#define SDSIO_SOCKET_TIMEOUT            5000U
+#endif
+
+// Maximum number of buffers sent with one sendmsg call
+#ifndef SDSIO_SOCKET_IOV_MAX
+#define SDSIO_SOCKET_IOV_MAX            8U
+#endif
+
+static int sock = -1;
+
+/**
+  \fn          int32_t sdsioClientInit (void)
+  \brief       Initialize SDSIO-Client.
+  \return      SDS_OK on success or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsioClientInit (void) {
+  struct sockaddr_in addr;
+  struct timeval     tv;
+  const char        *ip;
+  const char        *port;
+  int                opt_val;
+
+  if (sock != -1) {
+    // Client is already initialized.
+    return SDS_OK;
+  }
+
+  ip = getenv("SDSIO_SERVER_IP");
+  if (ip == NULL) {
+    ip = SDSIO_SOCKET_SERVER_IP;
+  }
+  port = getenv("SDSIO_SERVER_PORT");
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port   = htons((port != NULL) ? (uint16_t)strtoul(port, NULL, 10) : (uint16_t)SDSIO_SOCKET_SERVER_PORT);
+  if (inet_pton(AF_INET, ip, &addr.sin_addr) != 1) {
+    SDS_PRINTF("SDSIO-Client socket interface: invalid server address %s!\n", ip);
+    return SDS_ERROR_IO;
+  }
+
+  sock = socket(AF_INET, SOCK_STREAM, 0);
+  if (sock < 0) {
+    sock = -1;
+    return SDS_ERROR_IO;
+  }
+
+  // Transfer timeout and low latency for small protocol messages.
+  tv.tv_sec  = SDSIO_SOCKET_TIMEOUT / 1000U;
+  tv.tv_usec = (SDSIO_SOCKET_TIMEOUT % 1000U) * 1000U;
+  setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+  setsockopt(sock, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+  opt_val = 1;
+  setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &opt_val, sizeof(opt_val));
+
+  if (connect(sock, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+    SDS_PRINTF("SDSIO-Client socket interface initialization failed or 'sdsio-server socket' unavailable at %s:%u !\n",
+               ip, (unsigned int)ntohs(addr.sin_port));
+    close(sock);
+    sock = -1;
+    return SDS_ERROR_IO;
+  }
+
+  SDS_PRINTF("SDSIO-Client socket interface initialized successfully.\n");
+  SDS_PRINTF("Connection to SDSIO-Server established at %s:%u\n", ip, (unsigned int)ntohs(addr.sin_port));
+
+  return SDS_OK;
+}
+
+/**
+  \fn          int32_t sdsioClientUninit (void)
+  \brief       Un-Initialize SDSIO-Client.
+  \return      SDS_OK on success or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsioClientUninit (void) {
+  uint8_t buf[64];
+
+  if (sock != -1) {
+    // Graceful close: closing the socket with unread data resets the connection
+    // and SDSIO-Server discards data which it has not processed yet.
+    shutdown(sock, SHUT_WR);
+    while (recv(sock, buf, sizeof(buf), 0) > 0) {
+      // Discard data until SDSIO-Server closes the connection (or timeout).
+    }
+    close(sock);
+    sock = -1;
+  }
+  return SDS_OK;
+}
+
+/**
+  \fn          int32_t sdsioClientSend (const uint8_t *buf, uint32_t buf_size)
+  \brief       Send data to SDSIO-Server (blocking).
+  \param[in]   buf         pointer to buffer with data to send
+  \param[in]   buf_size    buffer size in bytes
+  \return      number of bytes successfully sent or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsioClientSend (const uint8_t *buf, uint32_t buf_size) {
+  uint32_t num = 0U;
+  int32_t  ret = SDS_ERROR;
+  ssize_t  n;
+
+  while (num < buf_size) {
+    n = send(sock, buf + num, buf_size - num, MSG_NOSIGNAL);
+    if (n >= 0) {
+      num += (uint32_t)n;
+    } else if (errno == EINTR) {
+      continue;
+    } else {
+      if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+        // Timeout happened.
+        ret = SDS_ERROR_TIMEOUT;
+      } else {
+        // Error happened.
+        ret = SDS_ERROR_IO;
+      }
+      break;
+    }
+  }
+
+  if (num != 0U) {
+    ret = (int32_t)num;
+  }
+
+  return ret;
+}
+
+/**
+  \fn          int32_t sdsioClientSendv (const sdsioVec_t *vec, uint32_t vec_cnt)
+  \brief       Send data from multiple buffers to SDSIO-Server (gather, blocking).
+  \param[in]   vec         pointer to array of buffers with data to send
+  \param[in]   vec_cnt     number of buffers in array
+  \return      number of bytes successfully sent or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsioClientSendv (const sdsioVec_t *vec, uint32_t vec_cnt) {
+  struct iovec  iov[SDSIO_SOCKET_IOV_MAX];
+  struct msghdr msg;
+  uint32_t      num = 0U;
+  uint32_t      idx = 0U;
+  uint32_t      ofs = 0U;
+  uint32_t      cnt;
+  int32_t       ret = SDS_OK;
+  ssize_t       n;
+
+  while (idx < vec_cnt) {
+    // Buffers not sent yet (first one from offset of partial send).
+    for (cnt = 0U; ((idx + cnt) < vec_cnt) && (cnt < SDSIO_SOCKET_IOV_MAX); cnt++) {
+      iov[cnt].iov_base = (uint8_t *)vec[idx + cnt].buf + ((cnt == 0U) ? ofs : 0U);
+      iov[cnt].iov_len  = vec[idx + cnt].buf_size   - ((cnt == 0U) ? ofs : 0U);
+    }
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov    = iov;
+    msg.msg_iovlen = cnt;
+
+    n = sendmsg(sock, &msg, MSG_NOSIGNAL);
+    if (n >= 0) {
+      num += (uint32_t)n;
+      // Skip sent buffers.
+      n += (ssize_t)ofs;
+      while ((idx < vec_cnt) && ((size_t)n >= vec[idx].buf_size)) {
+        n -= (ssize_t)vec[idx].buf_size;
+        idx++;
+      }
+      ofs = (uint32_t)n;
+    } else if (errno == EINTR) {
+      continue;
+    } else {
+      if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+        // Timeout happened.
+        ret = SDS_ERROR_TIMEOUT;
+      } else {
+        // Error happened.
+        ret = SDS_ERROR_IO;
+      }
+      break;
+    }
+  }
+
+  if ((num != 0U) || (ret == SDS_OK)) {
+    ret = (int32_t)num;
+  }
+
+  return ret;
+}
+
+/**
+  \fn          int32_t sdsioClientReceive (uint8_t *buf, uint32_t buf_size, sdsioReceiveMode_t mode)
+  \brief       Receive data from SDSIO-Server in blocking or non-blocking mode.
+  \param[out]  buf          pointer to the buffer where received data will be stored
+  \param[in]   buf_size     buffer size in bytes
+  \param[in]   mode         blocking or non-blocking mode (see \ref sdsioReceiveMode_t)
+  \return      number of bytes successfully received or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsioClientReceive (uint8_t *buf, uint32_t buf_size, sdsioReceiveMode_t mode) {
+  uint32_t num = 0U;
+  int32_t  ret = SDS_OK;
+  ssize_t  n;
+
+  if ((buf == NULL) || (buf_size == 0U)) {
+    return SDS_ERROR_PARAMETER;
+  }
+
+  if (mode == sdsioReceiveNonBlocking) { // Non-blocking mode
+    n = recv(sock, buf, buf_size, MSG_DONTWAIT);
+    if (n > 0) {
+      ret = (int32_t)n;
+    } else {
+      ret = 0;
+    }
+    return ret;
+  }
+
+  while (num < buf_size) {              // Blocking mode
+    n = recv(sock, buf + num, buf_size - num, 0);
+    if (n > 0) {
+      num += (uint32_t)n;
+    } else if ((n < 0) && (errno == EINTR)) {
+      continue;
+    } else {
+      if ((n < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK))) {
+        // Timeout happened.
+        ret = SDS_ERROR_TIMEOUT;
+      } else {
+        // Connection closed or error happened.
+        ret = SDS_ERROR_IO;
+      }
+      break;
+    }
+  }
+
+  if (ret == SDS_OK) {
+    ret = (int32_t)num;
+  }
+
+  return ret;
+}
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Chunked record test (file system SDSIO interface, files are written to the working directory)
+//  Records smaller and larger than the stream buffer are written in chunks (sdsWriteBegin, sdsWriteChunk,
+//  sdsWriteEnd) and read in chunks (sdsReadBegin, sdsReadChunk, sdsReadEnd). A record which is not written
+//  completely is padded with zeros. A record which is not read completely is discarded by sdsReadEnd and
+//  reading continues with the next record.
+//  Exit code is 0 when all checks pass.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "cmsis_os2.h"
+#include "sds.h"
+
+#define RECORD_CNT      12U             // Number of records (timeslot = record number)
+#define RECORD_SIZE_MAX 5000U           // Maximum record size
+#define CHUNK_SIZE      200U            // Size of chunks written and read
+#define PARTIAL_SIZE    10U             // Data read from records which are not read completely
+
+#define PADDED          4U              // Record which is not written completely (half of the data is written)
+
+#define TIMEOUT         1000U           // Timeout in ticks
+
+// Record size: small records and records larger than the stream buffer
+#define RECORD_SIZE(t)  ((((t) % 3U) == 1U) ? (3000U + ((t) * 100U)) : (50U + ((t) * 10U)))
+
+static uint8_t  sds_buf[1024];
+static uint8_t  data[RECORD_SIZE_MAX], ref[RECORD_SIZE_MAX];
+static uint32_t failed;
+
+// Report failed check.
+static void check (uint32_t cond, const char *msg, uint32_t timeslot, int32_t value) {
+  if (cond == 0U) {
+    printf("Error: %s (timeslot %u, value %d)\n", msg, timeslot, value);
+    failed++;
+  }
+}
+
+// Fill record data for timeslot (record which is not written completely: second half is zero).
+static void fill (uint8_t *buf, uint32_t timeslot) {
+  uint32_t n;
+
+  for (n = 0U; n < RECORD_SIZE(timeslot); n++) {
+    buf[n] = (uint8_t)((timeslot * 31U) + (n * 7U) + 1U);
+  }
+  if (timeslot == PADDED) {
+    memset(buf + (RECORD_SIZE(timeslot) / 2U), 0, RECORD_SIZE(timeslot) - (RECORD_SIZE(timeslot) / 2U));
+  }
+}
+
+// Write record in chunks.
+static void write_record (sdsId_t id, uint32_t timeslot) {
+  uint32_t size = RECORD_SIZE(timeslot);
+  uint32_t n, cnt;
+  int32_t  num;
+
+  if (timeslot == PADDED) {
+    size /= 2U;
+  }
+  fill(data, timeslot);
+  num = sdsWriteBegin(id, timeslot, RECORD_SIZE(timeslot));
+  check(num == SDS_OK, "sdsWriteBegin failed", timeslot, num);
+  for (n = 0U; (n < size) && (num >= 0); n += cnt) {
+    cnt = ((size - n) > CHUNK_SIZE) ? CHUNK_SIZE : (size - n);
+    num = sdsWriteChunk(id, data + n, cnt, TIMEOUT);
+    check(num == (int32_t)cnt, "sdsWriteChunk failed", timeslot, num);
+  }
+  num = sdsWriteEnd(id);
+  if (timeslot == PADDED) {
+    check(num == SDS_ERROR, "incomplete record not reported", timeslot, num);
+  } else {
+    check(num == SDS_OK, "sdsWriteEnd failed", timeslot, num);
+  }
+}
+
+// Begin reading a record in chunks (wait until the record header is available).
+static int32_t read_begin (sdsId_t id, uint32_t *timeslot) {
+  uint32_t n;
+  int32_t  num;
+
+  for (n = 0U; n < TIMEOUT; n++) {
+    num = sdsReadBegin(id, timeslot);
+    if (num != SDS_NO_DATA) {
+      break;
+    }
+    osDelay(1U);
+  }
+  return num;
+}
+
+// Read record in chunks (odd records: only the first chunk is read and the rest is discarded).
+static void read_record (sdsId_t id, uint32_t t) {
+  uint32_t timeslot, size, n, cnt;
+  int32_t  num;
+
+  num = read_begin(id, &timeslot);
+  check((num == (int32_t)RECORD_SIZE(t)) && (timeslot == t), "sdsReadBegin returned wrong record", t, num);
+  if (num < 0) {
+    return;
+  }
+  size = ((t % 2U) != 0U) ? PARTIAL_SIZE : (uint32_t)num;
+  for (n = 0U; (n < size) && (num >= 0); n += cnt) {
+    cnt = ((size - n) > CHUNK_SIZE) ? CHUNK_SIZE : (size - n);
+    num = sdsReadChunk(id, data + n, cnt, TIMEOUT);
+    check(num == (int32_t)cnt, "sdsReadChunk failed", t, num);
+  }
+  fill(ref, t);
+  check(memcmp(data, ref, size) == 0, "record data does not match", t, 0);
+  num = sdsReadEnd(id);
+  if ((t % 2U) != 0U) {
+    check(num == SDS_ERROR, "discarded rest of record not reported", t, num);
+  } else {
+    check(num == SDS_OK, "sdsReadEnd failed", t, num);
+  }
+}
+
+int main (void) {
+  uint32_t t, timeslot;
+  sdsId_t  id;
+  int32_t  num;
+
+  // Start with a fresh recording (session 0).
+  remove("chunk.0.sds");
+
+  if (sdsInit(NULL) != SDS_OK) {
+    printf("Error: sdsInit failed\n");
+    return 1;
+  }
+
+  id = sdsOpen("chunk", sdsModeWrite, sds_buf, sizeof(sds_buf));
+  if (id == NULL) {
+    printf("Error: sdsOpen for recording failed\n");
+    return 1;
+  }
+  for (t = 0U; (t < RECORD_CNT) && (failed == 0U); t++) {
+    write_record(id, t);
+  }
+  sdsClose(id);
+
+  sdsFlagsModify(SDS_FLAG_PLAYBACK, 0U);
+  id = sdsOpen("chunk", sdsModeRead, sds_buf, sizeof(sds_buf));
+  if (id == NULL) {
+    printf("Error: sdsOpen for play back failed\n");
+    return 1;
+  }
+  for (t = 0U; (t < RECORD_CNT) && (failed == 0U); t++) {
+    if ((t % 6U) == 2U) {
+      // Records which are not read in chunks follow a discarded record.
+      num = sdsReadTimeout(id, &timeslot, data, sizeof(data), TIMEOUT);
+      fill(ref, t);
+      check((num == (int32_t)RECORD_SIZE(t)) && (timeslot == t) && (memcmp(data, ref, RECORD_SIZE(t)) == 0),
+            "sdsReadTimeout returned wrong record", t, num);
+    } else {
+      read_record(id, t);
+    }
+  }
+  num = read_begin(id, &timeslot);
+  check(num == SDS_EOS, "end of stream not reported", t, num);
+  sdsClose(id);
+  sdsFlagsModify(0U, SDS_FLAG_PLAYBACK);
+
+  sdsUninit();
+
+  printf("%s\n", (failed == 0U) ? "PASS" : "FAIL");
+
+  return (failed == 0U) ? 0 : 1;
+}
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Multi-producer stream test (file system SDSIO interface, files are written to the working directory)
+//  Several threads write records concurrently to one stream with sdsWrite, sdsWritev and sdsWriteBatch
+//  (SDS_CONTROL_MULTI_PRODUCER). Every record is played back complete and the records of each producer
+//  are in the order in which they were written.
+//  Exit code is 0 when all checks pass.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "cmsis_os2.h"
+#include "sds.h"
+
+#define PRODUCER_CNT    4U              // Number of producer threads
+#define RECORD_CNT      20000U          // Number of records written by each producer
+#define RECORD_SIZE_MAX 44U             // Maximum record size
+
+#define TIMEOUT         1000U           // Timeout in ticks
+
+// Record size: depends on producer and record number (header: producer, 24-bit record number)
+#define RECORD_SIZE(p, i)  (4U + ((((p) * 7U) + ((i) * 13U)) % (RECORD_SIZE_MAX - 4U)))
+
+static uint8_t           sds_buf[4096];
+static sdsId_t           stream;
+static volatile uint32_t producer_done;
+static volatile uint32_t failed;
+
+// Report failed check.
+static void check (uint32_t cond, const char *msg, uint32_t index, int32_t value) {
+  if (cond == 0U) {
+    printf("Error: %s (record %u, value %d)\n", msg, index, value);
+    failed++;
+  }
+}
+
+// Fill record data of producer p.
+static void fill (uint8_t *data, uint32_t p, uint32_t i) {
+  uint32_t n;
+
+  data[0] = (uint8_t)p;
+  data[1] = (uint8_t)i;
+  data[2] = (uint8_t)(i >> 8);
+  data[3] = (uint8_t)(i >> 16);
+  for (n = 4U; n < RECORD_SIZE(p, i); n++) {
+    data[n] = (uint8_t)((p * 31U) + (i * 7U) + n);
+  }
+}
+
+// Producer thread: writes records with the producer number as timeslot.
+static void producer (void *arg) {
+  uint32_t    p = (uint32_t)(uintptr_t)arg;
+  uint32_t    i, size;
+  uint8_t     data[RECORD_SIZE_MAX];
+  sdsVec_t    vec[2];
+  sdsRecord_t rec;
+  int32_t     num;
+
+  for (i = 0U; (i < RECORD_CNT) && (failed == 0U); i++) {
+    size = RECORD_SIZE(p, i);
+    fill(data, p, i);
+    do {
+      switch ((p + i) % 3U) {
+        case 0U:
+          num = sdsWrite(stream, p, data, size);
+          break;
+        case 1U:
+          vec[0].buf      = data;
+          vec[0].buf_size = 3U;
+          vec[1].buf      = data + 3U;
+          vec[1].buf_size = size - 3U;
+          num = sdsWritev(stream, p, vec, 2U);
+          break;
+        default:
+          rec.timeslot = p;
+          rec.buf      = data;
+          rec.buf_size = size;
+          num = sdsWriteBatch(stream, &rec, 1U);
+          if (num == 1) {
+            num = (int32_t)size;
+          } else if (num == 0) {
+            num = SDS_NO_SPACE;
+          }
+          break;
+      }
+      if (num == SDS_NO_SPACE) {
+        osDelay(1U);
+      }
+    } while (num == SDS_NO_SPACE);
+    check(num == (int32_t)size, "record not written", i, num);
+  }
+
+  __atomic_add_fetch(&producer_done, 1U, __ATOMIC_SEQ_CST);
+}
+
+int main (void) {
+  uint32_t   next[PRODUCER_CNT] = { 0U };
+  uint8_t    data[RECORD_SIZE_MAX], ref[RECORD_SIZE_MAX];
+  uint32_t   n, p, i, timeslot;
+  sdsStats_t stats;
+  sdsBlock_t block;
+  int32_t    num;
+
+  // Start with a fresh recording (session 0).
+  remove("producers.0.sds");
+  remove("pow2.1.sds");
+
+  if (sdsInit(NULL) != SDS_OK) {
+    printf("Error: sdsInit failed\n");
+    return 1;
+  }
+
+  stream = sdsOpen("producers", sdsModeWrite, sds_buf, sizeof(sds_buf));
+  if (stream == NULL) {
+    printf("Error: sdsOpen for recording failed\n");
+    return 1;
+  }
+  num = sdsControl(stream, SDS_CONTROL_MULTI_PRODUCER, 2U);
+  check(num == SDS_ERROR_PARAMETER, "invalid multi-producer argument accepted", 0U, num);
+  num = sdsControl(stream, SDS_CONTROL_MULTI_PRODUCER, 1U);
+  check(num == SDS_OK, "multi-producer mode not enabled", 0U, num);
+  num = sdsControl(stream, SDS_CONTROL_RECORDER, 1U);
+  check(num == SDS_ERROR, "flight recorder enabled in multi-producer mode", 0U, num);
+  num = sdsWriteAcquire(stream, 0U, 10U, &block);
+  check(num == SDS_ERROR, "sdsWriteAcquire accepted in multi-producer mode", 0U, num);
+
+  for (p = 0U; p < PRODUCER_CNT; p++) {
+    if (osThreadNew(producer, (void *)(uintptr_t)p, NULL) == NULL) {
+      printf("Error: producer thread not created\n");
+      return 1;
+    }
+  }
+  while (producer_done != PRODUCER_CNT) {
+    osDelay(1U);
+  }
+
+  num = sdsControl(stream, SDS_CONTROL_MULTI_PRODUCER, 0U);
+  check(num == SDS_ERROR, "multi-producer mode disabled after data was written", 0U, num);
+  sdsGetStats(stream, &stats);
+  check(stats.records == (PRODUCER_CNT * RECORD_CNT), "wrong number of records", 0U, (int32_t)stats.records);
+  sdsClose(stream);
+
+  // Play back: records of each producer are complete and in order.
+  sdsFlagsModify(SDS_FLAG_PLAYBACK, 0U);
+  stream = sdsOpen("producers", sdsModeRead, sds_buf, sizeof(sds_buf));
+  if (stream == NULL) {
+    printf("Error: sdsOpen for play back failed\n");
+    return 1;
+  }
+  for (n = 0U; (n < (PRODUCER_CNT * RECORD_CNT)) && (failed == 0U); n++) {
+    num = sdsReadTimeout(stream, &timeslot, data, sizeof(data), TIMEOUT);
+    if ((num <= 0) || (timeslot >= PRODUCER_CNT)) {
+      check(0U, "record not read", n, num);
+      break;
+    }
+    i = data[1] | ((uint32_t)data[2] << 8) | ((uint32_t)data[3] << 16);
+    check((data[0] == timeslot) && (i == next[timeslot]), "record of producer out of order", n, (int32_t)i);
+    fill(ref, timeslot, i);
+    check((num == (int32_t)RECORD_SIZE(timeslot, i)) && (memcmp(data, ref, (uint32_t)num) == 0),
+          "record data does not match", n, num);
+    next[timeslot]++;
+  }
+  num = sdsReadTimeout(stream, &timeslot, data, sizeof(data), TIMEOUT);
+  check(num == SDS_EOS, "end of stream not reported", n, num);
+  sdsClose(stream);
+  sdsFlagsModify(0U, SDS_FLAG_PLAYBACK);
+
+  // Multi-producer mode requires a buffer size which is a power of two.
+  stream = sdsOpen("pow2", sdsModeWrite, sds_buf, 3000U);
+  if (stream != NULL) {
+    num = sdsControl(stream, SDS_CONTROL_MULTI_PRODUCER, 1U);
+    check(num == SDS_ERROR, "multi-producer mode enabled with buffer size not a power of two", 0U, num);
+    sdsClose(stream);
+  }
+
+  sdsUninit();
+
+  printf("%s\n", (failed == 0U) ? "PASS" : "FAIL");
+
+  return (failed == 0U) ? 0 : 1;
+}
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// sdsReadAligned test (file system SDSIO interface, files are written to the working directory)
+//  Streams recorded at different rates: the slower stream returns its last data block for every timeslot
+//  until the following data block is due and SDS_EOS after its last data block.
+//  Stream buffer which is full with one data block and part of the next header: the data block is selected
+//  instead of waiting for a header which cannot be received.
+//  Exit code is 0 when all checks pass.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "cmsis_os2.h"
+#include "sds.h"
+
+#define FAST_PERIOD     1U              // Timeslot period of the fast stream
+#define SLOW_PERIOD     4U              // Timeslot period of the slow stream
+#define TIMESLOT_CNT    20U             // Number of timeslots recorded
+#define SLOW_LAST       (((TIMESLOT_CNT - 1U) / SLOW_PERIOD) * SLOW_PERIOD) // Timeslot of the last slow record
+
+#define FULL_PERIOD     10U             // Timeslot period of the stream played back with a full buffer
+#define FULL_CNT        3U              // Number of records of the stream played back with a full buffer
+#define FULL_SIZE       100U            // Record size of the stream played back with a full buffer
+
+#define TIMEOUT         1000U           // Timeout in ticks
+
+static uint8_t  sds_buf[3][1024];
+static uint32_t failed;
+
+// Report failed check.
+static void check (uint32_t cond, const char *msg, uint32_t timeslot, int32_t value) {
+  if (cond == 0U) {
+    printf("Error: %s (timeslot %u, value %d)\n", msg, timeslot, value);
+    failed++;
+  }
+}
+
+// Record stream with one record for every period (record content is the timeslot).
+static int32_t record (const char *name, sdsId_t id, uint32_t timeslot, uint32_t period, uint32_t size) {
+  uint8_t data[FULL_SIZE];
+
+  if ((timeslot % period) != 0U) {
+    return SDS_OK;
+  }
+  memset(data, (int)timeslot, size);
+  if (sdsWrite(id, timeslot, data, size) != (int32_t)size) {
+    printf("Error: sdsWrite %s failed\n", name);
+    return SDS_ERROR;
+  }
+  return SDS_OK;
+}
+
+// Streams recorded at different rates.
+static void test_rates (void) {
+  sdsAlignedRecord_t rec[2];
+  sdsId_t            id[2];
+  uint8_t            buf[2][4];
+  uint32_t           t, n;
+  int32_t            num;
+
+  // Record both streams in one session.
+  id[0] = sdsOpen("fast", sdsModeWrite, sds_buf[0], sizeof(sds_buf[0]));
+  id[1] = sdsOpen("slow", sdsModeWrite, sds_buf[1], sizeof(sds_buf[1]));
+  if ((id[0] == NULL) || (id[1] == NULL)) {
+    printf("Error: sdsOpen for recording failed\n");
+    failed++;
+    return;
+  }
+  for (t = 0U; t < TIMESLOT_CNT; t++) {
+    if ((record("fast", id[0], t, FAST_PERIOD, 4U) != SDS_OK) ||
+        (record("slow", id[1], t, SLOW_PERIOD, 4U) != SDS_OK)) {
+      failed++;
+      break;
+    }
+  }
+  sdsClose(id[0]);
+  sdsClose(id[1]);
+
+  // Play back both streams aligned to every timeslot.
+  sdsFlagsModify(SDS_FLAG_PLAYBACK, 0U);
+  id[0] = sdsOpen("fast", sdsModeRead, sds_buf[0], sizeof(sds_buf[0]));
+  id[1] = sdsOpen("slow", sdsModeRead, sds_buf[1], sizeof(sds_buf[1]));
+  if ((id[0] == NULL) || (id[1] == NULL)) {
+    printf("Error: sdsOpen for play back failed\n");
+    failed++;
+    return;
+  }
+  for (n = 0U; n < 2U; n++) {
+    rec[n].buf      = buf[n];
+    rec[n].buf_size = sizeof(buf[n]);
+  }
+  for (t = 0U; t < TIMESLOT_CNT; t++) {
+    num = sdsReadAligned(id, rec, 2U, t, TIMEOUT);
+    check(rec[0].timeslot == t, "fast stream returned wrong data block", t, (int32_t)rec[0].timeslot);
+    if (t <= SLOW_LAST) {
+      check(num == 2, "sdsReadAligned did not return both streams", t, num);
+      check(rec[1].timeslot == (t - (t % SLOW_PERIOD)), "slow stream returned wrong data block", t, (int32_t)rec[1].timeslot);
+      check(buf[1][0] == (uint8_t)rec[1].timeslot, "slow stream data does not match", t, buf[1][0]);
+    } else {
+      // Last data block of the slow stream has been returned.
+      check(num == 1, "sdsReadAligned did not return the fast stream", t, num);
+      check(rec[1].status == SDS_EOS, "end of slow stream not reported", t, rec[1].status);
+    }
+  }
+  num = sdsReadAligned(id, rec, 2U, t, TIMEOUT);
+  check(num == 0, "sdsReadAligned returned data after end of streams", t, num);
+  check((rec[0].status == SDS_EOS) && (rec[1].status == SDS_EOS), "end of streams not reported", t, rec[1].status);
+
+  sdsClose(id[0]);
+  sdsClose(id[1]);
+  sdsFlagsModify(0U, SDS_FLAG_PLAYBACK);
+}
+
+// Stream played back with a buffer which is full with one data block and part of the next header.
+static void test_full (void) {
+  sdsAlignedRecord_t rec;
+  sdsId_t            id;
+  uint8_t            buf[FULL_SIZE];
+  uint32_t           t, n;
+  int32_t            num;
+
+  id = sdsOpen("full", sdsModeWrite, sds_buf[2], sizeof(sds_buf[2]));
+  if (id == NULL) {
+    printf("Error: sdsOpen for recording failed\n");
+    failed++;
+    return;
+  }
+  for (n = 0U; n < FULL_CNT; n++) {
+    if (record("full", id, n * FULL_PERIOD, FULL_PERIOD, FULL_SIZE) != SDS_OK) {
+      failed++;
+      break;
+    }
+  }
+  sdsClose(id);
+
+  // Buffer holds the data block, its header and half of the next header.
+  sdsFlagsModify(SDS_FLAG_PLAYBACK, 0U);
+  id = sdsOpen("full", sdsModeRead, sds_buf[2], FULL_SIZE + 8U + 4U);
+  if (id == NULL) {
+    printf("Error: sdsOpen for play back failed\n");
+    failed++;
+    return;
+  }
+  rec.buf      = buf;
+  rec.buf_size = sizeof(buf);
+  for (n = 0U; n < FULL_CNT; n++) {
+    t   = (n * FULL_PERIOD) + (FULL_PERIOD / 2U);
+    num = sdsReadAligned(&id, &rec, 1U, t, TIMEOUT);
+    check(num == 1, "sdsReadAligned did not return the data block", t, rec.status);
+    check(rec.timeslot == (n * FULL_PERIOD), "wrong data block returned", t, (int32_t)rec.timeslot);
+  }
+  num = sdsReadAligned(&id, &rec, 1U, t + FULL_PERIOD, TIMEOUT);
+  check(rec.status == SDS_EOS, "end of stream not reported", t + FULL_PERIOD, rec.status);
+
+  sdsClose(id);
+  sdsFlagsModify(0U, SDS_FLAG_PLAYBACK);
+}
+
+int main (void) {
+
+  // Start with fresh recordings (session 0: fast and slow, session 1: full).
+  remove("fast.0.sds");
+  remove("slow.0.sds");
+  remove("full.1.sds");
+
+  if (sdsInit(NULL) != SDS_OK) {
+    printf("Error: sdsInit failed\n");
+    return 1;
+  }
+
+  test_rates();
+  test_full();
+
+  sdsUninit();
+
+  printf("%s\n", (failed == 0U) ? "PASS" : "FAIL");
+
+  return (failed == 0U) ? 0 : 1;
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Record index test (file system SDSIO interface, files are written to the working directory)
+//  A stream is played back with sdsPeekTimeslot, sdsGetSize and sdsSkip between the reads: the timeslot and
+//  size of the next record are returned without reading it and skipped records are not returned by sdsRead.
+//  Exit code is 0 when all checks pass.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "cmsis_os2.h"
+#include "sds.h"
+
+#define RECORD_CNT      5000U           // Number of records
+#define RECORD_SIZE_MAX 3000U           // Maximum record size
+#define PERIOD          10U             // Timeslot period
+
+#define TIMEOUT         1000U           // Timeout in ticks
+
+// Record size: depends on record number
+#define RECORD_SIZE(i)  (1U + (((i) * 37U) % RECORD_SIZE_MAX))
+
+static uint8_t  sds_buf[20000];
+static uint8_t  data[RECORD_SIZE_MAX], ref[RECORD_SIZE_MAX];
+static uint32_t failed;
+
+// Report failed check.
+static void check (uint32_t cond, const char *msg, uint32_t index, int32_t value) {
+  if (cond == 0U) {
+    printf("Error: %s (record %u, value %d)\n", msg, index, value);
+    failed++;
+  }
+}
+
+// Fill record data.
+static void fill (uint8_t *buf, uint32_t i) {
+  uint32_t n;
+
+  for (n = 0U; n < RECORD_SIZE(i); n++) {
+    buf[n] = (uint8_t)((i * 31U) + (n * 7U));
+  }
+}
+
+int main (void) {
+  uint32_t i, n, timeslot, skipped, wait;
+  sdsId_t  id;
+  int32_t  num;
+
+  // Start with a fresh recording (session 0).
+  remove("index.0.sds");
+
+  if (sdsInit(NULL) != SDS_OK) {
+    printf("Error: sdsInit failed\n");
+    return 1;
+  }
+
+  id = sdsOpen("index", sdsModeWrite, sds_buf, sizeof(sds_buf));
+  if (id == NULL) {
+    printf("Error: sdsOpen for recording failed\n");
+    return 1;
+  }
+  for (i = 0U; (i < RECORD_CNT) && (failed == 0U); i++) {
+    fill(data, i);
+    num = sdsWriteTimeout(id, i * PERIOD, data, RECORD_SIZE(i), TIMEOUT);
+    check(num == (int32_t)RECORD_SIZE(i), "record not written", i, num);
+  }
+  sdsClose(id);
+
+  sdsFlagsModify(SDS_FLAG_PLAYBACK, 0U);
+  id = sdsOpen("index", sdsModeRead, sds_buf, sizeof(sds_buf));
+  if (id == NULL) {
+    printf("Error: sdsOpen for play back failed\n");
+    return 1;
+  }
+  num = sdsSkip(id, 0U);
+  check(num == 0, "sdsSkip of no records failed", 0U, num);
+  num = sdsPeekTimeslot(id, NULL);
+  check(num == SDS_ERROR_PARAMETER, "sdsPeekTimeslot accepted NULL pointer", 0U, num);
+
+  i       = 0U;
+  skipped = 0U;
+  wait    = 0U;
+  while ((i < RECORD_CNT) && (failed == 0U)) {
+    num = sdsPeekTimeslot(id, &timeslot);
+    if ((num == SDS_NO_DATA) && (wait < TIMEOUT)) {
+      // Record header is not received yet.
+      osDelay(1U);
+      wait++;
+      continue;
+    }
+    wait = 0U;
+    check((num == SDS_OK) && (timeslot == (i * PERIOD)), "sdsPeekTimeslot returned wrong timeslot", i, num);
+    num = sdsGetSize(id);
+    check(num == (int32_t)RECORD_SIZE(i), "sdsGetSize returned wrong size", i, num);
+
+    if ((i % 7U) == 3U) {
+      // Skip up to n records (only records available in the stream buffer are skipped).
+      n   = 1U + (i % 13U);
+      num = sdsSkip(id, n);
+      check((num > 0) && (num <= (int32_t)n), "sdsSkip failed", i, num);
+      if (num > 0) {
+        i       += (uint32_t)num;
+        skipped += (uint32_t)num;
+      }
+      continue;
+    }
+    if ((RECORD_SIZE(i) > 5U) && ((i % 11U) == 0U)) {
+      num = sdsRead(id, &timeslot, data, RECORD_SIZE(i) - 1U);
+      check(num == SDS_ERROR_PARAMETER, "record read into too small buffer", i, num);
+    }
+    num = sdsReadTimeout(id, &timeslot, data, sizeof(data), TIMEOUT);
+    fill(ref, i);
+    check((num == (int32_t)RECORD_SIZE(i)) && (timeslot == (i * PERIOD)) && (memcmp(data, ref, RECORD_SIZE(i)) == 0),
+          "sdsReadTimeout returned wrong record", i, num);
+    i++;
+  }
+  check(skipped != 0U, "no records skipped", i, 0);
+
+  // End of stream.
+  for (wait = 0U; wait < TIMEOUT; wait++) {
+    num = sdsSkip(id, 5U);
+    if (num != 0) {
+      break;
+    }
+    osDelay(1U);
+  }
+  check(num == SDS_EOS, "sdsSkip did not report end of stream", i, num);
+  num = sdsPeekTimeslot(id, &timeslot);
+  check(num == SDS_EOS, "sdsPeekTimeslot did not report end of stream", i, num);
+  num = sdsGetSize(id);
+  check(num == SDS_EOS, "sdsGetSize did not report end of stream", i, num);
+  num = sdsRead(id, &timeslot, data, sizeof(data));
+  check(num == SDS_EOS, "sdsRead did not report end of stream", i, num);
+
+  sdsClose(id);
+  sdsFlagsModify(0U, SDS_FLAG_PLAYBACK);
+
+  sdsUninit();
+
+  printf("%s\n", (failed == 0U) ? "PASS" : "FAIL");
+
+  return (failed == 0U) ? 0 : 1;
+}
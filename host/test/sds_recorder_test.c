@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Flight recorder test (file system SDSIO interface, files are written to the working directory)
+//  Records are written to a stream in flight recorder mode (SDS_CONTROL_RECORDER): the oldest records are
+//  dropped until sdsTrigger captures a window of records before and after the trigger. Only the captured
+//  windows are recorded, each one with complete records in order.
+//  Exit code is 0 when all checks pass.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "cmsis_os2.h"
+#include "sds.h"
+
+#define RECORD_CNT      8000U           // Number of records written (timeslot = record number)
+#define RECORD_SIZE_MAX 64U             // Maximum record size
+
+#define TRIGGER1        2000U           // Timeslot of the first trigger
+#define TRIGGER1_PRE    100U            //  timeslots captured before the trigger
+#define TRIGGER1_POST   50U             //  timeslots captured after the trigger
+#define TRIGGER2        6000U           // Timeslot of the second trigger
+#define TRIGGER2_PRE    30U             //  timeslots captured before the trigger
+#define TRIGGER2_POST   300U            //  timeslots captured after the trigger
+
+#define TIMEOUT         1000U           // Timeout in ticks
+
+// Record size: depends on timeslot
+#define RECORD_SIZE(t)  (1U + (((t) * 37U) % RECORD_SIZE_MAX))
+
+static uint8_t  sds_buf[4096];
+static uint32_t failed;
+
+// Report failed check.
+static void check (uint32_t cond, const char *msg, uint32_t timeslot, int32_t value) {
+  if (cond == 0U) {
+    printf("Error: %s (timeslot %u, value %d)\n", msg, timeslot, value);
+    failed++;
+  }
+}
+
+// Fill record data for timeslot.
+static void fill (uint8_t *data, uint32_t timeslot) {
+  uint32_t n;
+
+  for (n = 0U; n < RECORD_SIZE(timeslot); n++) {
+    data[n] = (uint8_t)((timeslot * 31U) + (n * 7U));
+  }
+}
+
+// Write record with one of the write functions (wait while the captured window is transferred).
+static int32_t write_record (sdsId_t id, uint32_t timeslot) {
+  uint8_t     data[RECORD_SIZE_MAX];
+  uint32_t    size = RECORD_SIZE(timeslot);
+  sdsVec_t    vec[2];
+  sdsBlock_t  block;
+  sdsRecord_t rec;
+  int32_t     num;
+
+  fill(data, timeslot);
+  do {
+    switch (timeslot % 4U) {
+      case 0U:
+        num = sdsWriteTimeout(id, timeslot, data, size, TIMEOUT);
+        break;
+      case 1U:
+        vec[0].buf      = data;
+        vec[0].buf_size = size / 2U;
+        vec[1].buf      = data + (size / 2U);
+        vec[1].buf_size = size - (size / 2U);
+        num = sdsWritev(id, timeslot, vec, 2U);
+        break;
+      case 2U:
+        num = sdsWriteAcquire(id, timeslot, size, &block);
+        if (num > 0) {
+          memcpy(block.buf1, data, (block.size1 < size) ? block.size1 : size);
+          if (block.size1 < size) {
+            memcpy(block.buf2, data + block.size1, size - block.size1);
+          }
+          num = sdsWriteCommit(id, size);
+        }
+        break;
+      default:
+        rec.timeslot = timeslot;
+        rec.buf      = data;
+        rec.buf_size = size;
+        num = sdsWriteBatch(id, &rec, 1U);
+        if (num == 1) {
+          num = (int32_t)size;
+        }
+        break;
+    }
+    if (num == SDS_NO_SPACE) {
+      osDelay(1U);
+    }
+  } while (num == SDS_NO_SPACE);
+
+  return num;
+}
+
+int main (void) {
+  uint8_t  data[RECORD_SIZE_MAX], ref[RECORD_SIZE_MAX];
+  uint32_t begin[3], end[3];
+  uint32_t t, timeslot, windows;
+  sdsId_t  id;
+  int32_t  num;
+
+  // Start with a fresh recording (session 0).
+  remove("recorder.0.sds");
+
+  if (sdsInit(NULL) != SDS_OK) {
+    printf("Error: sdsInit failed\n");
+    return 1;
+  }
+
+  id = sdsOpen("recorder", sdsModeWrite, sds_buf, sizeof(sds_buf));
+  if (id == NULL) {
+    printf("Error: sdsOpen for recording failed\n");
+    return 1;
+  }
+  num = sdsTrigger(id, 1U, 1U);
+  check(num == SDS_ERROR, "trigger accepted without flight recorder mode", 0U, num);
+  num = sdsControl(id, SDS_CONTROL_RECORDER, 2U);
+  check(num == SDS_ERROR_PARAMETER, "invalid flight recorder argument accepted", 0U, num);
+  num = sdsControl(id, SDS_CONTROL_RECORDER, 1U);
+  check(num == SDS_OK, "flight recorder mode not enabled", 0U, num);
+
+  for (t = 0U; (t < RECORD_CNT) && (failed == 0U); t++) {
+    num = write_record(id, t);
+    check(num == (int32_t)RECORD_SIZE(t), "record not written", t, num);
+    if (t == 1000U) {
+      num = sdsControl(id, SDS_CONTROL_RECORDER, 0U);
+      check(num == SDS_ERROR, "flight recorder mode disabled after data was written", t, num);
+    }
+    if (t == TRIGGER1) {
+      num = sdsTrigger(id, TRIGGER1_PRE, TRIGGER1_POST);
+      check(num == SDS_OK, "first trigger failed", t, num);
+      num = sdsTrigger(id, 1U, 1U);
+      check(num == SDS_ERROR, "trigger accepted while a window is captured", t, num);
+    }
+    if (t == TRIGGER2) {
+      // First window is transferred: trigger again.
+      num = sdsFlush(id);
+      check(num == SDS_OK, "flush failed", t, num);
+      num = sdsTrigger(id, TRIGGER2_PRE, TRIGGER2_POST);
+      check(num == SDS_OK, "second trigger failed", t, num);
+    }
+  }
+  sdsClose(id);
+
+  // Play back: only the captured windows are recorded.
+  sdsFlagsModify(SDS_FLAG_PLAYBACK, 0U);
+  id = sdsOpen("recorder", sdsModeRead, sds_buf, sizeof(sds_buf));
+  if (id == NULL) {
+    printf("Error: sdsOpen for play back failed\n");
+    return 1;
+  }
+  windows = 0U;
+  t       = 0U;
+  while (failed == 0U) {
+    num = sdsReadTimeout(id, &timeslot, data, sizeof(data), TIMEOUT);
+    if (num == SDS_EOS) {
+      break;
+    }
+    fill(ref, timeslot);
+    check((num == (int32_t)RECORD_SIZE(timeslot)) && (memcmp(data, ref, (uint32_t)num) == 0),
+          "record data does not match", timeslot, num);
+    if ((windows == 0U) || (timeslot != (t + 1U))) {
+      // Start of a captured window.
+      if (windows == 3U) {
+        check(0U, "too many captured windows", timeslot, (int32_t)windows);
+        break;
+      }
+      begin[windows] = timeslot;
+      windows++;
+    }
+    end[windows - 1U] = timeslot;
+    t = timeslot;
+  }
+  sdsClose(id);
+  sdsFlagsModify(0U, SDS_FLAG_PLAYBACK);
+
+  check(windows == 2U, "wrong number of captured windows", 0U, (int32_t)windows);
+  if (windows == 2U) {
+    // Records before the trigger are limited by the buffer size.
+    check((begin[0] >= (TRIGGER1 - TRIGGER1_PRE)) && (begin[0] < TRIGGER1), "wrong begin of first window", begin[0], 0);
+    check(end[0]   == (TRIGGER1 + TRIGGER1_POST), "wrong end of first window",    end[0],   0);
+    check(begin[1] == (TRIGGER2 - TRIGGER2_PRE),  "wrong begin of second window", begin[1], 0);
+    check(end[1]   == (TRIGGER2 + TRIGGER2_POST), "wrong end of second window",   end[1],   0);
+  }
+
+  sdsUninit();
+
+  printf("%s\n", (failed == 0U) ? "PASS" : "FAIL");
+
+  return (failed == 0U) ? 0 : 1;
+}
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// sdsSeek test (file system SDSIO interface, files are written to the working directory)
+//  A stream is repositioned forward and backward, to its last record, after its end and after the end of
+//  stream has been reported: sdsRead continues with the first record at or after the requested timeslot.
+//  Exit code is 0 when all checks pass.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "cmsis_os2.h"
+#include "sds.h"
+
+#define RECORD_CNT      5000U           // Number of records
+#define PERIOD          2U              // Timeslot period
+
+#define TIMEOUT         1000U           // Timeout in ticks
+
+// Record size: depends on record number (first word is the record number)
+#define RECORD_SIZE(i)  (4U * (1U + ((i) % 16U)))
+
+static uint8_t  sds_buf[2048];
+static uint32_t failed;
+
+// Report failed check.
+static void check (uint32_t cond, const char *msg, uint32_t index, int32_t value) {
+  if (cond == 0U) {
+    printf("Error: %s (record %u, value %d)\n", msg, index, value);
+    failed++;
+  }
+}
+
+// Read cnt records starting with record first.
+static void read_from (sdsId_t id, uint32_t first, uint32_t cnt, const char *msg) {
+  uint32_t data[16];
+  uint32_t i, timeslot;
+  int32_t  num;
+
+  for (i = first; (i < (first + cnt)) && (i < RECORD_CNT); i++) {
+    num = sdsReadTimeout(id, &timeslot, data, sizeof(data), TIMEOUT);
+    if ((num != (int32_t)RECORD_SIZE(i)) || (timeslot != (i * PERIOD)) || (data[0] != i)) {
+      check(0U, msg, i, num);
+      break;
+    }
+  }
+}
+
+// Reposition stream to timeslot.
+static void seek (sdsId_t id, uint32_t timeslot) {
+  int32_t num;
+
+  num = sdsSeek(id, timeslot);
+  check(num == SDS_OK, "sdsSeek failed", timeslot, num);
+}
+
+int main (void) {
+  uint32_t data[16];
+  uint32_t i, timeslot;
+  sdsId_t  id;
+  int32_t  num;
+
+  // Start with a fresh recording (session 0).
+  remove("seek.0.sds");
+
+  if (sdsInit(NULL) != SDS_OK) {
+    printf("Error: sdsInit failed\n");
+    return 1;
+  }
+
+  id = sdsOpen("seek", sdsModeWrite, sds_buf, sizeof(sds_buf));
+  if (id == NULL) {
+    printf("Error: sdsOpen for recording failed\n");
+    return 1;
+  }
+  num = sdsSeek(id, 0U);
+  check(num == SDS_ERROR, "sdsSeek accepted for write stream", 0U, num);
+  for (i = 0U; (i < RECORD_CNT) && (failed == 0U); i++) {
+    data[0] = i;
+    num = sdsWriteTimeout(id, i * PERIOD, data, RECORD_SIZE(i), TIMEOUT);
+    check(num == (int32_t)RECORD_SIZE(i), "record not written", i, num);
+  }
+  sdsClose(id);
+
+  sdsFlagsModify(SDS_FLAG_PLAYBACK, 0U);
+  id = sdsOpen("seek", sdsModeRead, sds_buf, sizeof(sds_buf));
+  if (id == NULL) {
+    printf("Error: sdsOpen for play back failed\n");
+    return 1;
+  }
+  read_from(id, 0U, 10U, "wrong record after open");
+
+  // Forward and backward (timeslot between two records: next record is returned).
+  seek(id, 5000U);
+  read_from(id, 2500U, 300U, "wrong record after seek forward");
+  seek(id, 201U);
+  read_from(id, 101U, 50U, "wrong record after seek backward");
+
+  // Not allowed while a record is read in chunks.
+  for (i = 0U; i < TIMEOUT; i++) {
+    num = sdsReadBegin(id, &timeslot);
+    if (num != SDS_NO_DATA) {
+      break;
+    }
+    osDelay(1U);
+  }
+  check(num == (int32_t)RECORD_SIZE(151U), "sdsReadBegin failed", 151U, num);
+  num = sdsSeek(id, 0U);
+  check(num == SDS_ERROR, "sdsSeek accepted while a record is read in chunks", 151U, num);
+  sdsReadEnd(id);
+
+  // Start of stream, whole stream and end of stream.
+  seek(id, 0U);
+  read_from(id, 0U, RECORD_CNT, "wrong record after seek to start");
+  num = sdsReadTimeout(id, &timeslot, data, sizeof(data), TIMEOUT);
+  check(num == SDS_EOS, "end of stream not reported", RECORD_CNT, num);
+
+  // Last record and after the end of stream.
+  seek(id, (RECORD_CNT - 1U) * PERIOD);
+  read_from(id, RECORD_CNT - 1U, 1U, "wrong record after seek to last record");
+  seek(id, RECORD_CNT * PERIOD * 2U);
+  num = sdsReadTimeout(id, &timeslot, data, sizeof(data), TIMEOUT);
+  check(num == SDS_EOS, "end of stream not reported after seek past the end", RECORD_CNT, num);
+
+  // Stream which has reported the end of stream.
+  seek(id, 7000U);
+  read_from(id, 3500U, 1500U, "wrong record after seek at end of stream");
+
+  sdsClose(id);
+  sdsFlagsModify(0U, SDS_FLAG_PLAYBACK);
+
+  sdsUninit();
+
+  printf("%s\n", (failed == 0U) ? "PASS" : "FAIL");
+
+  return (failed == 0U) ? 0 : 1;
+}
@@ -17,19 +17,20 @@
  *
  * Name:    sds_config.h
  * Purpose: SDS configuration options
- * Rev.:    V3.0.0
+ * Rev.:    V3.1.0
  */
 
 //-------- <<< Use Configuration Wizard in Context Menu >>> --------------------
 
 // <h>SDS System Configuration
 
-//   <o>Maximum concurrent streams <1-31>
+//   <o>Maximum concurrent streams <1-65535>
 //   <i>Default: 16
 #define SDS_MAX_STREAMS                 16U
 
 //   <o>Internal buffer size for I/O transfers
 //   <i>Default: 8192
+//   <i>Not used: data is transferred directly from/to the stream buffers in blocks of the SDSIO transfer size
 #define SDS_BUF_SIZE                    8192U
 
 // </h>
@@ -52,4 +53,29 @@
 // Default: 8192
 // Select a value appropriate for the underlying I/O interface (e.g., socket, USART, VCOM, file system)
 // to ensure efficient read/write performance
+// Replaced by the transfer size reported by the SDSIO interface (SDSIO-Client: negotiated with SDSIO-Server)
 #define SDS_IO_TRANSFER_SIZE            8192U
+
+// Power-of-two stream buffer sizes
+// Default: 0
+// Set to 1 when all stream buffer sizes are a power of two: circular buffer indices are then computed
+// with masks instead of wrap-around compares. sdsOpen fails for buffer sizes which are not a power of two.
+#ifndef SDS_BUFFER_POW2
+#define SDS_BUFFER_POW2                 0
+#endif
+
+// Cache maintenance of stream buffers
+// Default: 0
+// Set to 1 on devices with data cache (for example Cortex-M7 or Cortex-M55) when SDSIO interfaces transfer data with DMA
+// directly from and to the stream buffers: the data cache is cleaned before data is written to the SDSIO interface and
+// invalidated after data is read from the SDSIO interface (see sdsCacheClean and sdsCacheInvalidate).
+// Stream buffers must be aligned to and a multiple of SDS_CACHE_LINE_SIZE, otherwise sdsOpen fails.
+#ifndef SDS_CACHE_MAINTENANCE
+#define SDS_CACHE_MAINTENANCE           0
+#endif
+
+// Data cache line size in bytes
+// Default: 32
+#ifndef SDS_CACHE_LINE_SIZE
+#define SDS_CACHE_LINE_SIZE             32U
+#endif
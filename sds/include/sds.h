@@ -43,8 +43,21 @@ typedef void *sdsId_t;                  // Handle to SDS stream
 
 // Event codes for sdsEvent callback function
 #define SDS_EVENT_ERROR_IO      (1UL)   ///< Event triggered when an SDS I/O error occurs.
-#define SDS_EVENT_NO_SPACE      (2UL)   ///< Event triggered when \ref sdsWrite fails due to insufficient space in the SDS circular buffer.
+#define SDS_EVENT_NO_SPACE      (2UL)   ///< Event triggered when a write function fails due to insufficient space in the SDS circular buffer.
 #define SDS_EVENT_NO_DATA       (4UL)   ///< Event triggered when \ref sdsRead fails due to insufficient data in the SDS circular buffer.
+#define SDS_EVENT_OPEN          (8UL)   ///< Event triggered when the SDS circular buffer of a read stream opened with \ref sdsOpenAsync is filled.
+
+// SDS stream control codes for sdsControl function
+#define SDS_CONTROL_PRIORITY    (1UL)   ///< Set stream priority class; arg = priority (see \ref SDS_Priority)
+#define SDS_CONTROL_QUANTUM     (2UL)   ///< Set maximum number of bytes transferred in one scheduling step; arg = bytes (0 = default)
+#define SDS_CONTROL_LATENCY     (3UL)   ///< Set maximum latency of data in the write buffer; arg = ticks (0 = disabled)
+#define SDS_CONTROL_RECORDER    (4UL)   ///< Set flight recorder mode of the write stream; arg = 1 (enabled) or 0 (disabled)
+#define SDS_CONTROL_MULTI_PRODUCER (5UL) ///< Set multi-producer mode of the write stream; arg = 1 (enabled) or 0 (disabled)
+
+// SDS stream priority classes
+#define SDS_PRIORITY_LOW        (0UL)   ///< Low priority (bulk data).
+#define SDS_PRIORITY_NORMAL     (1UL)   ///< Normal priority (default).
+#define SDS_PRIORITY_HIGH       (2UL)   ///< High priority (low-latency data).
 
 // SDS stream open mode
 typedef enum {
@@ -52,6 +65,64 @@ typedef enum {
   sdsModeWrite = 1                      // Open SDS stream for write (binary)
 } sdsMode_t;
 
+// SDS stream payload codec (OR-ed with sdsModeWrite, same values as SDSIO_CODEC_xxx)
+#define SDS_MODE_Msk            (0xFFUL)
+#define SDS_CODEC_DELTA16(ch)   ((0x01UL | ((((ch) - 1UL) & 0x0FUL) << 4)) << 8) ///< Delta-varint coding of 16-bit samples; ch = number of interleaved channels (1..16)
+
+// SDS data block region (data block is split into two segments on circular buffer rollover)
+typedef struct {
+  void     *buf1;                       // Pointer to first segment of the data block
+  uint32_t  size1;                      // Size of first segment in bytes
+  void     *buf2;                       // Pointer to second segment of the data block (NULL when not split)
+  uint32_t  size2;                      // Size of second segment in bytes
+} sdsBlock_t;
+
+// SDS record (data block with timeslot) for batched write
+typedef struct {
+  uint32_t    timeslot;                 // Timeslot value
+  const void *buf;                      // Pointer to the data block
+  uint32_t    buf_size;                 // Size of the data block in bytes
+} sdsRecord_t;
+
+// SDS stream open parameters for opening a group of streams
+typedef struct {
+  const char *name;                     // SDS stream name (pointer to NULL terminated string)
+  sdsMode_t   mode;                     // SDS stream opening mode
+  void       *buf;                      // Pointer to buffer for SDS stream
+  uint32_t    buf_size;                 // Buffer size in bytes
+} sdsOpenParam_t;
+
+// SDS record of a stream in a group for timeslot-aligned read
+typedef struct {
+  void       *buf;                      // Pointer to the data block buffer
+  uint32_t    buf_size;                 // Size of the data block buffer in bytes
+  uint32_t    timeslot;                 // Timeslot of the data block read
+  int32_t     status;                   // Number of bytes read, 0 (no record at or before the timeslot) or a negative value
+} sdsAlignedRecord_t;
+
+// SDS data block segment for vectored write
+typedef struct {
+  const void *buf;                      // Pointer to the data block segment
+  uint32_t    buf_size;                 // Size of the data block segment in bytes
+} sdsVec_t;
+
+// Number of bins in SDSIO transfer time histogram
+#define SDS_STATS_HIST_SIZE     16U
+
+// SDS stream statistics
+typedef struct {
+  uint32_t bytes_in;                    // Total bytes written to the SDS circular buffer (including headers)
+  uint32_t bytes_out;                   // Total bytes read from the SDS circular buffer (including headers)
+  uint32_t records;                     // Number of data blocks written (write mode) or read (read mode)
+  uint32_t buf_size;                    // Size of the SDS circular buffer in bytes
+  uint32_t buf_max;                     // Maximum amount of data in the SDS circular buffer in bytes (high-water mark)
+  uint32_t no_space_cnt;                // Number of write operations failed with SDS_NO_SPACE
+  uint32_t no_data_cnt;                 // Number of read operations failed with SDS_NO_DATA
+  uint32_t io_cnt;                      // Number of SDSIO transfers
+  uint32_t io_time;                     // Cumulative time of SDSIO transfers in microseconds
+  uint32_t io_hist[SDS_STATS_HIST_SIZE];// SDSIO transfer time histogram (bin n: 2^n to 2^(n+1)-1 microseconds)
+} sdsStats_t;
+
 /**
   \typedef void (*sdsEvent_t) (sdsId_t id, uint32_t event)
   \brief       Callback function for SDS stream events.
@@ -88,6 +159,28 @@ int32_t sdsUninit (void);
 */
 sdsId_t sdsOpen (const char *name, sdsMode_t mode, void *buf, uint32_t buf_size);
 
+/**
+  \fn          sdsId_t sdsOpenAsync (const char *name, sdsMode_t mode, void *buf, uint32_t buf_size)
+  \brief       Open SDS stream without waiting for the circular buffer of a read stream to be filled.
+  \param[in]   name           SDS stream name (pointer to NULL terminated string)
+  \param[in]   mode           SDS stream opening mode (see \ref sdsMode_t)
+  \param[in]   buf            pointer to buffer for SDS stream
+  \param[in]   buf_size       buffer size in bytes
+  \return      \ref sdsId_t handle to SDS stream, or NULL if operation failed
+*/
+sdsId_t sdsOpenAsync (const char *name, sdsMode_t mode, void *buf, uint32_t buf_size);
+
+/**
+  \fn          int32_t sdsOpenGroup (const sdsOpenParam_t *param, sdsId_t *id, uint32_t cnt)
+  \brief       Open a group of SDS streams, fill the circular buffers of the read streams concurrently.
+  \param[in]   param          pointer to array of \ref sdsOpenParam_t stream open parameters
+  \param[out]  id             pointer to array receiving the \ref sdsId_t handles to SDS streams
+  \param[in]   cnt            number of streams in the group
+  \return      SDS_OK on success or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsOpenGroup (const sdsOpenParam_t *param, sdsId_t *id, uint32_t cnt);
+
 /**
   \fn          int32_t sdsClose (sdsId_t id)
   \brief       Close SDS stream.
@@ -109,6 +202,97 @@ int32_t sdsClose (sdsId_t id);
 */
 int32_t sdsWrite (sdsId_t id, uint32_t timeslot, const void *buf, uint32_t buf_size);
 
+/**
+  \fn          int32_t sdsWriteTimeout (sdsId_t id, uint32_t timeslot, const void *buf, uint32_t buf_size, uint32_t timeout)
+  \brief       Write entire data block to the SDS stream opened in write mode, wait for space in the circular buffer.
+  \param[in]   id             \ref sdsId_t handle to SDS stream
+  \param[in]   timeslot       timeslot
+  \param[in]   buf            pointer to the data block buffer to be written
+  \param[in]   buf_size       size of the data block buffer in bytes
+  \param[in]   timeout        timeout in kernel ticks (0 = no wait, osWaitForever = wait indefinitely)
+  \return      number of bytes successfully written or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsWriteTimeout (sdsId_t id, uint32_t timeslot, const void *buf, uint32_t buf_size, uint32_t timeout);
+
+/**
+  \fn          int32_t sdsWriteBatch (sdsId_t id, const sdsRecord_t *rec, uint32_t rec_cnt)
+  \brief       Write multiple data blocks along with their timeslot information to the SDS stream opened in write mode.
+  \param[in]   id             \ref sdsId_t handle to SDS stream
+  \param[in]   rec            pointer to array of \ref sdsRecord_t records to be written
+  \param[in]   rec_cnt        number of records in array
+  \return      number of records successfully written or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsWriteBatch (sdsId_t id, const sdsRecord_t *rec, uint32_t rec_cnt);
+
+/**
+  \fn          int32_t sdsWritev (sdsId_t id, uint32_t timeslot, const sdsVec_t *vec, uint32_t vec_cnt)
+  \brief       Write data block composed of multiple buffers along with its timeslot information to the SDS stream opened in write mode.
+  \param[in]   id             \ref sdsId_t handle to SDS stream
+  \param[in]   timeslot       timeslot
+  \param[in]   vec            pointer to array of \ref sdsVec_t data block segments
+  \param[in]   vec_cnt        number of segments in array
+  \return      number of bytes successfully written or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsWritev (sdsId_t id, uint32_t timeslot, const sdsVec_t *vec, uint32_t vec_cnt);
+
+/**
+  \fn          int32_t sdsWriteAcquire (sdsId_t id, uint32_t timeslot, uint32_t buf_size, sdsBlock_t *block)
+  \brief       Acquire space for a data block directly in the circular buffer of the SDS stream opened in write mode.
+  \param[in]   id             \ref sdsId_t handle to SDS stream
+  \param[in]   timeslot       timeslot
+  \param[in]   buf_size       size of the data block in bytes
+  \param[out]  block          pointer to \ref sdsBlock_t structure receiving the data block region
+  \return      number of bytes acquired or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsWriteAcquire (sdsId_t id, uint32_t timeslot, uint32_t buf_size, sdsBlock_t *block);
+
+/**
+  \fn          int32_t sdsWriteCommit (sdsId_t id, uint32_t buf_size)
+  \brief       Commit data block previously acquired with \ref sdsWriteAcquire to the SDS stream.
+  \param[in]   id             \ref sdsId_t handle to SDS stream
+  \param[in]   buf_size       size of the data block in bytes (0 to discard the acquired data block)
+  \return      number of bytes successfully committed or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsWriteCommit (sdsId_t id, uint32_t buf_size);
+
+/**
+  \fn          int32_t sdsWriteBegin (sdsId_t id, uint32_t timeslot, uint32_t total_size)
+  \brief       Begin writing a record in chunks to the SDS stream opened in write mode.
+  \param[in]   id             \ref sdsId_t handle to SDS stream
+  \param[in]   timeslot       timeslot
+  \param[in]   total_size     size of the whole data block in bytes
+  \return      SDS_OK on success or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsWriteBegin (sdsId_t id, uint32_t timeslot, uint32_t total_size);
+
+/**
+  \fn          int32_t sdsWriteChunk (sdsId_t id, const void *buf, uint32_t buf_size, uint32_t timeout)
+  \brief       Write data chunk of the record started with \ref sdsWriteBegin, wait for space in the circular buffer.
+  \param[in]   id             \ref sdsId_t handle to SDS stream
+  \param[in]   buf            pointer to the data chunk to be written
+  \param[in]   buf_size       size of the data chunk in bytes
+  \param[in]   timeout        timeout in kernel ticks (0 = no wait, osWaitForever = wait indefinitely)
+  \return      number of bytes successfully written or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsWriteChunk (sdsId_t id, const void *buf, uint32_t buf_size, uint32_t timeout);
+
+/**
+  \fn          int32_t sdsWriteEnd (sdsId_t id)
+  \brief       End writing the record started with \ref sdsWriteBegin, pad an incomplete record with zeros.
+  \param[in]   id             \ref sdsId_t handle to SDS stream
+  \return      SDS_OK on success,
+               SDS_ERROR when the record was incomplete and has been padded or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsWriteEnd (sdsId_t id);
+
 /**
   \fn          int32_t sdsRead (sdsId_t id, uint32_t *timeslot, void *buf, uint32_t buf_size)
   \brief       Read entire data block along with its timeslot information from the SDS stream opened in read mode.
@@ -121,6 +305,51 @@ int32_t sdsWrite (sdsId_t id, uint32_t timeslot, const void *buf, uint32_t buf_s
 */
 int32_t sdsRead (sdsId_t id, uint32_t *timeslot, void *buf, uint32_t buf_size);
 
+/**
+  \fn          int32_t sdsReadTimeout (sdsId_t id, uint32_t *timeslot, void *buf, uint32_t buf_size, uint32_t timeout)
+  \brief       Read entire data block from the SDS stream opened in read mode, wait for data in the circular buffer.
+  \param[in]   id             \ref sdsId_t handle to SDS stream
+  \param[out]  timeslot       pointer to buffer for a timeslot value
+  \param[out]  buf            pointer to the data block buffer to be read
+  \param[in]   buf_size       size of the data block buffer in bytes
+  \param[in]   timeout        timeout in kernel ticks (0 = no wait, osWaitForever = wait indefinitely)
+  \return      number of bytes successfully read, or
+               a negative value on error or SDS_EOS (see \ref SDS_Return_Codes)
+*/
+int32_t sdsReadTimeout (sdsId_t id, uint32_t *timeslot, void *buf, uint32_t buf_size, uint32_t timeout);
+
+/**
+  \fn          int32_t sdsReadBegin (sdsId_t id, uint32_t *timeslot)
+  \brief       Begin reading the next record in chunks from the SDS stream opened in read mode.
+  \param[in]   id             \ref sdsId_t handle to SDS stream
+  \param[out]  timeslot       pointer to buffer for a timeslot value
+  \return      size of the data block in bytes, or
+               a negative value on error or SDS_EOS (see \ref SDS_Return_Codes)
+*/
+int32_t sdsReadBegin (sdsId_t id, uint32_t *timeslot);
+
+/**
+  \fn          int32_t sdsReadChunk (sdsId_t id, void *buf, uint32_t buf_size, uint32_t timeout)
+  \brief       Read data chunk of the record started with \ref sdsReadBegin, wait for data in the circular buffer.
+  \param[in]   id             \ref sdsId_t handle to SDS stream
+  \param[out]  buf            pointer to the buffer for the data chunk
+  \param[in]   buf_size       size of the buffer in bytes
+  \param[in]   timeout        timeout in kernel ticks (0 = no wait, osWaitForever = wait indefinitely)
+  \return      number of bytes successfully read, or
+               a negative value on error or SDS_EOS (see \ref SDS_Return_Codes)
+*/
+int32_t sdsReadChunk (sdsId_t id, void *buf, uint32_t buf_size, uint32_t timeout);
+
+/**
+  \fn          int32_t sdsReadEnd (sdsId_t id)
+  \brief       End reading the record started with \ref sdsReadBegin.
+  \param[in]   id             \ref sdsId_t handle to SDS stream
+  \return      SDS_OK on success,
+               SDS_ERROR when the data block was not read completely and the rest has been discarded or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsReadEnd (sdsId_t id);
+
 /**
   \fn          int32_t sdsGetSize (sdsId_t id)
   \brief       Get data block size from an SDS stream opened in read mode.
@@ -130,6 +359,81 @@ int32_t sdsRead (sdsId_t id, uint32_t *timeslot, void *buf, uint32_t buf_size);
 */
 int32_t sdsGetSize (sdsId_t id);
 
+/**
+  \fn          int32_t sdsPeekTimeslot (sdsId_t id, uint32_t *timeslot)
+  \brief       Get timeslot of the next data block from an SDS stream opened in read mode (data block is not read).
+  \param[in]   id             \ref sdsId_t handle to SDS stream
+  \param[out]  timeslot       pointer to buffer for a timeslot value
+  \return      SDS_OK on success, or
+               a negative value on error or SDS_EOS (see \ref SDS_Return_Codes)
+*/
+int32_t sdsPeekTimeslot (sdsId_t id, uint32_t *timeslot);
+
+/**
+  \fn          int32_t sdsSkip (sdsId_t id, uint32_t n)
+  \brief       Skip data blocks of an SDS stream opened in read mode (data blocks are discarded without copy).
+  \param[in]   id             \ref sdsId_t handle to SDS stream
+  \param[in]   n              maximum number of data blocks to skip
+  \return      number of data blocks skipped, or
+               a negative value on error or SDS_EOS (see \ref SDS_Return_Codes)
+*/
+int32_t sdsSkip (sdsId_t id, uint32_t n);
+
+/**
+  \fn          int32_t sdsSeek (sdsId_t id, uint32_t timeslot)
+  \brief       Reposition SDS stream opened in read mode to the first data block at or after a timeslot.
+  \param[in]   id             \ref sdsId_t handle to SDS stream
+  \param[in]   timeslot       timeslot to seek to
+  \return      SDS_OK on success or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsSeek (sdsId_t id, uint32_t timeslot);
+
+/**
+  \fn          int32_t sdsReadAligned (const sdsId_t *id, sdsAlignedRecord_t *rec, uint32_t cnt, uint32_t timeslot, uint32_t timeout)
+  \brief       Read the data blocks at or nearest before a timeslot from a group of SDS streams opened in read mode
+               (the data block read is retained and returned again for later timeslots until a later data block is available).
+  \param[in]   id             pointer to array of \ref sdsId_t handles to SDS streams
+  \param[in,out] rec          pointer to array of \ref sdsAlignedRecord_t records (one for each stream)
+  \param[in]   cnt            number of streams in the group
+  \param[in]   timeslot       target timeslot
+  \param[in]   timeout        timeout in kernel ticks (0 = no wait, osWaitForever = wait indefinitely)
+  \return      number of data blocks read or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsReadAligned (const sdsId_t *id, sdsAlignedRecord_t *rec, uint32_t cnt, uint32_t timeslot, uint32_t timeout);
+
+/**
+  \fn          int32_t sdsFlush (sdsId_t id)
+  \brief       Flush data of the SDS stream opened in write mode.
+  \param[in]   id             \ref sdsId_t handle to SDS stream
+  \return      SDS_OK on success or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsFlush (sdsId_t id);
+
+/**
+  \fn          int32_t sdsTrigger (sdsId_t id, uint32_t pre, uint32_t post)
+  \brief       Trigger the flight recorder of the SDS stream opened in write mode.
+  \param[in]   id             \ref sdsId_t handle to SDS stream
+  \param[in]   pre            time before the trigger in timeslot units
+  \param[in]   post           time after the trigger in timeslot units
+  \return      SDS_OK on success or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsTrigger (sdsId_t id, uint32_t pre, uint32_t post);
+
+/**
+  \fn          int32_t sdsControl (sdsId_t id, uint32_t control, uint32_t arg)
+  \brief       Control SDS stream.
+  \param[in]   id             \ref sdsId_t handle to SDS stream
+  \param[in]   control        operation (see \ref SDS_Control_Codes)
+  \param[in]   arg            argument of operation
+  \return      SDS_OK on success or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsControl (sdsId_t id, uint32_t control, uint32_t arg);
+
 
 // ==== SDS Control Interface ====
 
@@ -217,6 +521,16 @@ extern volatile uint32_t sdsState;
 // Idle rate information
 extern volatile uint32_t sdsIdleRate;
 
+/**
+  \fn          int32_t sdsGetStats (sdsId_t id, sdsStats_t *stats)
+  \brief       Get runtime statistics of SDS stream.
+  \param[in]   id             \ref sdsId_t handle to SDS stream
+  \param[out]  stats          pointer to \ref sdsStats_t receiving the statistics
+  \return      SDS_OK on success or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsGetStats (sdsId_t id, sdsStats_t *stats);
+
 /**
   \fn          int32_t sdsExchange (void)
   \brief       Exchange information with the host.
@@ -233,6 +547,22 @@ int32_t sdsExchange (void);
 */
 void sdsFlagsModify (uint32_t set_mask, uint32_t clear_mask);
 
+/**
+  \fn          void sdsCacheClean (const void *addr, uint32_t size)
+  \brief       Clean data cache for a stream buffer region (called when SDS_CACHE_MAINTENANCE is enabled).
+  \param[in]   addr           region start address (aligned to SDS_CACHE_LINE_SIZE)
+  \param[in]   size           region size in bytes (multiple of SDS_CACHE_LINE_SIZE)
+*/
+void sdsCacheClean (const void *addr, uint32_t size);
+
+/**
+  \fn          void sdsCacheInvalidate (void *addr, uint32_t size)
+  \brief       Invalidate data cache for a stream buffer region (called when SDS_CACHE_MAINTENANCE is enabled).
+  \param[in]   addr           region start address (aligned to SDS_CACHE_LINE_SIZE)
+  \param[in]   size           region size in bytes (multiple of SDS_CACHE_LINE_SIZE)
+*/
+void sdsCacheInvalidate (void *addr, uint32_t size);
+
 #ifdef  __cplusplus
 }
 #endif
@@ -28,10 +28,44 @@
 #include "sds_config.h"
 #include "sds.h"
 #include "sds_buffer.h"
+#include "sds_internal.h"
 #include "sdsio.h"
 
-#if (SDS_MAX_STREAMS > 31)
-#error "Maximum number of concurrent SDS streams is 31!"
+#if (SDS_MAX_STREAMS > 65535)
+#error "Maximum number of concurrent SDS streams is 65535!"
+#endif
+
+#ifndef SDS_CACHE_MAINTENANCE
+#define SDS_CACHE_MAINTENANCE           0
+#endif
+#ifndef SDS_CACHE_LINE_SIZE
+#define SDS_CACHE_LINE_SIZE             32U
+#endif
+
+#if (SDS_CACHE_MAINTENANCE != 0)
+#if ((SDS_CACHE_LINE_SIZE & (SDS_CACHE_LINE_SIZE - 1U)) != 0U)
+#error "SDS_CACHE_LINE_SIZE must be a power of two!"
+#endif
+#if defined(_RTE_)
+// Device header: data cache functions (SCB_CleanDCache_by_Addr, SCB_CleanInvalidateDCache_by_Addr)
+#include "RTE_Components.h"
+#include CMSIS_device_header
+#endif
+#endif
+
+// Timeout for sdsFlush in milliseconds (default: same as close timeout)
+#ifndef SDS_FLUSH_TIMEOUT
+#define SDS_FLUSH_TIMEOUT               SDS_CLOSE_TIMEOUT
+#endif
+
+// Maximum number of SDSIO streams opened with one sdsioOpenGroup call (sdsOpenGroup)
+#ifndef SDS_OPEN_GROUP_SIZE
+#define SDS_OPEN_GROUP_SIZE             8U
+#endif
+
+// Number of entries in the record index of a stream opened in read mode
+#ifndef SDS_RECORD_INDEX_SIZE
+#define SDS_RECORD_INDEX_SIZE           8U
 #endif
 
 // Global error information
@@ -53,19 +87,54 @@ typedef struct {
 } dataBlockHead_t;
 #define HEAD_SIZE sizeof(dataBlockHead_t)
 
+// Record index entry (read mode)
+typedef struct {
+  uint32_t    offset;           // Stream position of the record header (total bytes written to the stream buffer)
+  uint32_t    size;             // Size of the data block in bytes
+  uint32_t    timeslot;         // Timeslot value
+} sdsRecordIndex_t;
+
 // SDS stream control block
 typedef struct {
-         uint8_t          index;            // Index of the SDS stream in psdsStreams array
+         uint16_t         index;            // Index of the SDS stream in psdsStreams array
          uint8_t          mode;             // Stream mode: SDS_STREAM_MODE_WRITE or SDS_STREAM_MODE_READ
 volatile uint8_t          flags;            // Stream flags: SDS_STREAM_FLAG_ ..
-         uint8_t          reserved;
+volatile uint8_t          priority;         // Stream priority: SDS_PRIORITY_ .. (ready queue the stream is added to)
+volatile uint8_t          priority_set;     // Stream priority set by sdsControl (applied when the stream is added to a ready queue)
 volatile uint32_t         state;            // Stream state: SDS_STREAM_STATE_ ..
-volatile uint32_t         lock;             // Lock for atomic operations
+volatile uint32_t         queued;           // Stream is in the ready queue
+         osEventFlagsId_t event;            // Stream event flags: SDS_STREAM_EVENT_ .. (created when the stream is opened)
+volatile uint32_t         lock;             // Lock for open and close operations
+volatile uint32_t         busy;             // Number of read/write operations in progress
          uint32_t         buf_size;         // Size of the buffer used for the stream
          uint32_t         threshold;        // Threshold value
+volatile uint32_t         quantum;          // Maximum number of bytes transferred in one scheduling step
+         uint32_t         transfer_size;    // SDSIO transfer size (reported by the SDSIO interface when the stream is opened)
+volatile uint32_t         latency;          // Maximum latency of data in the buffer in ticks (write mode, 0 = disabled)
+volatile uint32_t         flush;            // Flush request: transfer all data regardless of threshold
+volatile uint32_t         seek;             // Seek request (read mode, set by sdsSeek, cleared by sdsThread)
+         uint32_t         seek_timeslot;    // Timeslot to seek to (read mode)
+         int32_t          seek_status;      // Result of the seek request (read mode)
+         uint32_t         deadline;         // Tick count at which latency timer expires
+volatile uint32_t         multi;            // Multi-producer mode (write mode, 0 = disabled)
+volatile uint32_t         recorder;         // Flight recorder mode (write mode, 0 = disabled)
+volatile uint32_t         fr_state;         // Flight recorder state: SDS_RECORDER_ ..
+volatile uint32_t         fr_drop;          // Writing thread is dropping the oldest records (flight recorder armed)
+volatile uint32_t         fr_last;          // Timeslot of the last record written (flight recorder)
+         uint32_t         fr_begin;         // Timeslot at which the captured window begins (set by sdsTrigger)
+         uint32_t         fr_end;           // Timeslot at which the captured window ends (set by sdsTrigger)
+         uint32_t         fr_stop;          // Stream position at which the captured window ends (set by writing thread)
          sdsBufferId_t    sds_buffer;       // SDS Buffer stream handle
          sdsioId_t        sdsio;            // SDSIO interface handle
-         dataBlockHead_t  head;             // Data block header information
+         dataBlockHead_t  head;             // Data block header information (write mode: acquired block)
+         uint32_t         chunk;            // Record is written or read in chunks (accessed by the writing/reading thread only)
+         uint32_t         chunk_size;       // Remaining data size of the record written or read in chunks
+         sdsRecordIndex_t rec_index[SDS_RECORD_INDEX_SIZE]; // Record index ring (read mode, accessed by the reading thread only)
+         uint32_t         rec_in;           // Number of records added to the record index
+         uint32_t         rec_out;          // Number of records removed from the record index
+         uint32_t         rec_pos;          // Stream position of the next record header to be indexed
+         uint32_t         rec_held;         // Record at rec_out was read by sdsReadAligned and is retained for later timeslots
+         sdsStats_t       stats;            // Stream statistics
 } sdsStream_t;
 
 // Allocate memory for SDS streams depending on the configured maximum number of concurrent streams.
@@ -75,8 +144,8 @@ static sdsStream_t *psdsStreams[SDS_MAX_STREAMS] = {NULL};
 // Initialization flag
 static uint8_t sdsInitialized = 0U;
 
-// Data block buffer
-static uint8_t sdsDataBlockBuf[SDS_BUF_SIZE];
+// System timer frequency (used for SDSIO transfer time statistics)
+static uint32_t sdsSysTimerFreq = 0U;
 
 // Event callback
 static sdsEvent_t sdsEvent = NULL;
@@ -92,19 +161,38 @@ static const osThreadAttr_t sdsThreadAttr = {
 };
 static osThreadId_t sdsThreadId;
 
-// Close event flags
-static osEventFlagsId_t sdsCloseEventFlags;
+// Ready queue: lock-free queue of streams with pending work (multiple producers, sdsThread is the only consumer).
+//  Each stream is enqueued at most once (queued flag), so the queue can not overflow.
+typedef struct {
+volatile uint32_t         tail;                         // Enqueue position (reserved by producers)
+         uint32_t         head;                         // Dequeue position (accessed by sdsThread only)
+volatile uint32_t         entry[SDS_MAX_STREAMS];       // Stream index + 1 (0 = entry is empty)
+} sdsReadyQueue_t;
+
+// Ready queues (one for each stream priority)
+static sdsReadyQueue_t sdsReadyQueue[SDS_PRIORITY_HIGH + 1U];
 
-// Open event flags
-static osEventFlagsId_t sdsOpenEventFlags;
+// Latency timer list (streams with running latency timer, accessed by sdsThread only)
+static uint16_t sdsTimerList[SDS_MAX_STREAMS];
+static uint32_t sdsTimerCount = 0U;
 
-// Event definitions
-#define SDS_EVENT_FLAG_MASK             ((1UL << SDS_MAX_STREAMS) - 1)
+// Thread flag definitions
+#define SDS_THREAD_FLAG_READY           (1U << 0) // Stream added to the ready queue
+
+// Stream event flag definitions
+#define SDS_STREAM_EVENT_OPEN           (1U << 0) // Read stream buffer filled (sdsOpen)
+#define SDS_STREAM_EVENT_CLOSE          (1U << 1) // Stream closing processed (sdsClose)
+#define SDS_STREAM_EVENT_DATA           (1U << 2) // Data transferred or stream closing
+#define SDS_STREAM_EVENT_SEEK           (1U << 3) // Seek request processed (sdsSeek)
 
 // Flags definitions
 #define SDS_STREAM_HALT                 (1U << 0)
 #define SDS_STREAM_INITIAL_FILL         (1U << 1)
 #define SDS_STREAM_EOS                  (1U << 2)
+#define SDS_STREAM_FLUSH                (1U << 3)
+#define SDS_STREAM_TIMER                (1U << 4)
+#define SDS_STREAM_CAPTURE              (1U << 5)
+#define SDS_STREAM_ASYNC                (1U << 6)
 
 // Stream mode definitions
 #define SDS_STREAM_MODE_WRITE           (1U << 0)
@@ -117,6 +205,12 @@ static osEventFlagsId_t sdsOpenEventFlags;
 #define SDS_STREAM_STATE_WRITE          3U // Data stream is in write mode
 #define SDS_STREAM_STATE_CLOSING        4U // Close function is processed
 
+// Flight recorder state
+#define SDS_RECORDER_ARMED              0U // Oldest records are overwritten, no data is transferred
+#define SDS_RECORDER_TRIGGER            1U // Trigger is processed by sdsTrigger (still armed)
+#define SDS_RECORDER_CAPTURE            2U // Captured window is transferred, end of the window not reached yet
+#define SDS_RECORDER_STOP               3U // End of the window reached, data is transferred up to fr_stop
+
 // Helper functions:
 
 #if defined(__STDC_NO_ATOMICS__) || !defined(ATOMIC_CHAR32_T_LOCK_FREE) || (ATOMIC_CHAR32_T_LOCK_FREE < 2)
@@ -150,6 +244,52 @@ __STATIC_INLINE void atomic_rmw32 (uint32_t *mem, uint32_t set_mask, uint32_t cl
   }
 }
 
+// Atomic Operation: Add signed value to 32-bit value in memory.
+__STATIC_INLINE void atomic_add32 (uint32_t *mem, int32_t val) {
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  *mem = *mem + (uint32_t)val;
+  if (primask == 0U) {
+    __enable_irq();
+  }
+}
+
+// Atomic Operation: Increment 32-bit value in memory and wrap around to zero at limit.
+//  Return: value before increment.
+__STATIC_INLINE uint32_t atomic_inc32_wrap (uint32_t *mem, uint32_t limit) {
+  uint32_t primask = __get_PRIMASK();
+  uint32_t val;
+
+  __disable_irq();
+  val = *mem;
+  *mem = ((val + 1U) < limit) ? (val + 1U) : 0U;
+  if (primask == 0U) {
+    __enable_irq();
+  }
+
+  return val;
+}
+
+// Atomic Operation: Load 32-bit value from memory (sequentially consistent).
+__STATIC_INLINE uint32_t atomic_ld32 (uint32_t *mem) {
+  uint32_t val;
+
+  __DMB();
+  val = *(volatile uint32_t *)mem;
+  __DMB();
+
+  return val;
+}
+
+// Atomic Operation: Store 32-bit value to memory (sequentially consistent).
+__STATIC_INLINE void atomic_st32 (uint32_t *mem, uint32_t val) {
+
+  __DMB();
+  *(volatile uint32_t *)mem = val;
+  __DMB();
+}
+
 #else
 
 // Atomic Operation: Write 32-bit value to memory if existing value in memory is zero.
@@ -188,6 +328,74 @@ __STATIC_INLINE void atomic_rmw32 (uint32_t *mem, uint32_t set_mask, uint32_t cl
                                                   memory_order_relaxed));
 }
 
+// Atomic Operation: Add signed value to 32-bit value in memory.
+__STATIC_INLINE void atomic_add32 (uint32_t *mem, int32_t val) {
+  atomic_fetch_add_explicit((_Atomic uint32_t *)mem, (uint32_t)val, memory_order_seq_cst);
+}
+
+// Atomic Operation: Increment 32-bit value in memory and wrap around to zero at limit.
+//  Return: value before increment.
+__STATIC_INLINE uint32_t atomic_inc32_wrap (uint32_t *mem, uint32_t limit) {
+  uint32_t old_val;
+  uint32_t new_val;
+
+  old_val = *mem;
+  do {
+    new_val = ((old_val + 1U) < limit) ? (old_val + 1U) : 0U;
+  } while (!atomic_compare_exchange_weak_explicit((_Atomic uint32_t *)mem,
+                                                  &old_val,
+                                                  new_val,
+                                                  memory_order_acq_rel,
+                                                  memory_order_relaxed));
+
+  return old_val;
+}
+
+// Atomic Operation: Load 32-bit value from memory (sequentially consistent).
+__STATIC_INLINE uint32_t atomic_ld32 (uint32_t *mem) {
+  return atomic_load_explicit((_Atomic uint32_t *)mem, memory_order_seq_cst);
+}
+
+// Atomic Operation: Store 32-bit value to memory (sequentially consistent).
+__STATIC_INLINE void atomic_st32 (uint32_t *mem, uint32_t val) {
+  atomic_store_explicit((_Atomic uint32_t *)mem, val, memory_order_seq_cst);
+}
+
+#endif
+
+// Atomic Operation: Write pointer value to memory if existing value in memory is NULL.
+//  Return: 1 when new value is written or 0 otherwise.
+#if defined(__STDC_NO_ATOMICS__) || !defined(ATOMIC_POINTER_LOCK_FREE) || (ATOMIC_POINTER_LOCK_FREE < 2)
+__STATIC_INLINE uint32_t atomic_wrptr_if_null (void **mem, void *val) {
+  uint32_t primask = __get_PRIMASK();
+  uint32_t ret = 0U;
+
+  __disable_irq();
+  if (*mem == NULL) {
+    *mem = val;
+    ret = 1U;
+  }
+  if (primask == 0U) {
+    __enable_irq();
+  }
+
+  return ret;
+}
+#else
+__STATIC_INLINE uint32_t atomic_wrptr_if_null (void **mem, void *val) {
+  void    *expected = NULL;
+  uint32_t ret      = 0U;
+
+  if (atomic_compare_exchange_strong_explicit((void * _Atomic *)mem,
+                                              &expected,
+                                              val,
+                                              memory_order_acq_rel,
+                                              memory_order_relaxed)) {
+    ret = 1U;
+  }
+
+  return ret;
+}
 #endif
 
 static uint32_t sdsLockAcquire (sdsStream_t *stream, uint32_t timeout) {
@@ -213,13 +421,33 @@ static void sdsLockRelease (sdsStream_t *stream) {
   stream->lock = 0U;
 }
 
+// Enter stream operation (wait-free).
+//  The busy counter is incremented before the stream state is checked and sdsClose changes the state
+//  before it checks the busy counter, so either the operation observes the closing state or
+//  sdsClose waits until the operation has left the stream.
+//  Return: 1 when stream is in expected state or 0 otherwise.
+static uint32_t sdsEnter (sdsStream_t *stream, uint32_t state) {
+
+  atomic_add32((uint32_t *)&stream->busy, 1);
+  if (atomic_ld32((uint32_t *)&stream->state) != state) {
+    atomic_add32((uint32_t *)&stream->busy, -1);
+    return 0U;
+  }
+  return 1U;
+}
+
+// Leave stream operation.
+static void sdsLeave (sdsStream_t *stream) {
+  atomic_add32((uint32_t *)&stream->busy, -1);
+}
+
 static sdsStream_t * sdsAlloc (uint32_t *index) {
   sdsStream_t    *stream = NULL;
   static uint32_t idx = 0U;
   uint32_t        n;
 
   for (n = 0U; n < SDS_MAX_STREAMS; n++) {
-    if (atomic_wr32_if_zero((uint32_t *)&psdsStreams[idx], (uint32_t)&sdsStreams[idx]) != 0U) {
+    if (atomic_wrptr_if_null((void **)&psdsStreams[idx], &sdsStreams[idx]) != 0U) {
       stream = &sdsStreams[idx];
       if (index != NULL) {
         *index = idx;
@@ -238,95 +466,584 @@ static void sdsFree (uint32_t index) {
   psdsStreams[index] = NULL;
 }
 
+// Delete stream event flags (stream is closed or opening failed).
+static void sdsEventDelete (sdsStream_t *stream) {
+  osEventFlagsId_t event = stream->event;
+
+  stream->event = NULL;
+  if (event != NULL) {
+    osEventFlagsDelete(event);
+  }
+}
+
+// Add stream to the ready queue of its priority (no operation when stream is already queued).
+//  Producer reserves the entry position and then writes the entry; sdsThread stops at an entry which
+//  is not yet written and is notified again by the producer after the entry has been written.
+static void sdsReadyPush (sdsStream_t *stream) {
+  sdsReadyQueue_t *queue;
+  uint32_t         pos;
+
+  if (atomic_wr32_if_zero((uint32_t *)&stream->queued, 1U) == 0U) {
+    // Stream is already in the ready queue.
+    return;
+  }
+  // Priority changed by sdsControl is applied only while the stream is not in a ready queue.
+  stream->priority = stream->priority_set;
+  queue = &sdsReadyQueue[stream->priority];
+  pos   = atomic_inc32_wrap((uint32_t *)&queue->tail, SDS_MAX_STREAMS);
+  atomic_st32((uint32_t *)&queue->entry[pos], stream->index + 1U);
+}
+
+// Remove next stream from the ready queues (called by sdsThread only).
+//  Ready queue with the highest priority is served first; streams with the same priority are served in FIFO order.
+//  Return: pointer to stream control block or NULL when no stream is ready.
+static sdsStream_t * sdsReadyPop (void) {
+  sdsReadyQueue_t *queue;
+  sdsStream_t     *stream;
+  uint32_t         prio, val;
+
+  for (prio = SDS_PRIORITY_HIGH + 1U; prio != 0U; prio--) {
+    queue = &sdsReadyQueue[prio - 1U];
+    val   = atomic_ld32((uint32_t *)&queue->entry[queue->head]);
+    if (val == 0U) {
+      // Ready queue is empty (or next entry is not yet written).
+      continue;
+    }
+    atomic_st32((uint32_t *)&queue->entry[queue->head], 0U);
+    queue->head++;
+    if (queue->head >= SDS_MAX_STREAMS) {
+      queue->head = 0U;
+    }
+    stream = &sdsStreams[val - 1U];
+    // Stream can be enqueued again.
+    atomic_st32((uint32_t *)&stream->queued, 0U);
+    return stream;
+  }
+
+  return NULL;
+}
+
+// Notify sdsThread to process the stream.
+static void sdsSignal (sdsStream_t *stream) {
+
+  sdsReadyPush(stream);
+  osThreadFlagsSet(sdsThreadId, SDS_THREAD_FLAG_READY);
+}
+
+// Start latency timer: add stream to the latency timer list (called by sdsThread only).
+static void sdsTimerStart (sdsStream_t *stream) {
+
+  if (sdsTimerCount < SDS_MAX_STREAMS) {
+    sdsTimerList[sdsTimerCount++] = stream->index;
+    stream->flags |= SDS_STREAM_TIMER;
+  }
+}
+
+// Copy data to SDS Stream Buffer region.
+static void sdsRegionWrite (const sdsBufferRegion_t *region, const void *data) {
+
+  memcpy(region->buf1, data, region->size1);
+  if (region->size2 != 0U) {
+    memcpy(region->buf2, (const uint8_t *)data + region->size1, region->size2);
+  }
+}
+
+// Copy data to SDS Stream Buffer region at offset.
+//  Return: offset after the copied data.
+static uint32_t sdsRegionWriteAt (const sdsBufferRegion_t *region, uint32_t offset, const void *data, uint32_t size) {
+  uint32_t num;
+
+  if (offset < region->size1) {
+    num = region->size1 - offset;
+    if (num > size) {
+      num = size;
+    }
+    memcpy(region->buf1 + offset, data, num);
+    if (size > num) {
+      memcpy(region->buf2, (const uint8_t *)data + num, size - num);
+    }
+  } else {
+    memcpy(region->buf2 + (offset - region->size1), data, size);
+  }
+
+  return (offset + size);
+}
+
+// Copy data from SDS Stream Buffer region.
+static void sdsRegionRead (const sdsBufferRegion_t *region, void *data) {
+
+  memcpy(data, region->buf1, region->size1);
+  if (region->size2 != 0U) {
+    memcpy((uint8_t *)data + region->size1, region->buf2, region->size2);
+  }
+}
+
+// Discard the rest of the data block of a record whose reading in chunks was ended with sdsReadEnd (read mode).
+//  Data which is not yet in the SDS Stream Buffer is discarded when it arrives (chunk_size = remaining size).
+static void sdsChunkDiscard (sdsStream_t *stream) {
+  uint32_t num;
+
+  if ((stream->chunk == 0U) && (stream->chunk_size != 0U)) {
+    num = (uint32_t)sdsBufferGetCount(stream->sds_buffer);
+    if (num > stream->chunk_size) {
+      num = stream->chunk_size;
+    }
+    if (num != 0U) {
+      sdsBufferReadCommit(stream->sds_buffer, num);
+      stream->chunk_size -= num;
+      if ((stream->buf_size - sdsBufferGetCount(stream->sds_buffer)) >= stream->threshold) {
+        sdsSignal(stream);
+      }
+    }
+  }
+}
+
+// Update record index of the stream opened in read mode.
+//  Adds records which are completely available in the SDS Stream Buffer (header and data block) to the record index.
+//  Every header is parsed only once; the records stay in the SDS Stream Buffer until they are read or skipped.
+//  Return: number of records in the record index.
+static uint32_t sdsIndexUpdate (sdsStream_t *stream) {
+  sdsBufferRegion_t region;
+  sdsRecordIndex_t *rec;
+  dataBlockHead_t   head;
+  uint32_t          cnt_in, cnt_out;
+
+  // Discard the rest of a record ended early with sdsReadEnd (next header follows when it is discarded).
+  sdsChunkDiscard(stream);
+
+  sdsBufferGetCounters(stream->sds_buffer, &cnt_in, &cnt_out);
+
+  while ((stream->chunk_size == 0U) && ((stream->rec_in - stream->rec_out) < SDS_RECORD_INDEX_SIZE)) {
+    if ((cnt_in - stream->rec_pos) < HEAD_SIZE) {
+      // Header is not available.
+      break;
+    }
+    sdsBufferReadAcquire(stream->sds_buffer, stream->rec_pos - cnt_out, HEAD_SIZE, &region);
+    sdsRegionRead(&region, &head);
+    if ((cnt_in - stream->rec_pos - HEAD_SIZE) < head.data_size) {
+      // Data block is not completely available.
+      break;
+    }
+    rec = &stream->rec_index[stream->rec_in % SDS_RECORD_INDEX_SIZE];
+    rec->offset   = stream->rec_pos;
+    rec->size     = head.data_size;
+    rec->timeslot = head.timeslot;
+    stream->rec_in++;
+    stream->rec_pos += HEAD_SIZE + head.data_size;
+  }
+
+  return (stream->rec_in - stream->rec_out);
+}
+
+#if (SDS_CACHE_MAINTENANCE != 0)
+
+/**
+  Clean data cache for a stream buffer region (default implementation).
+*/
+__WEAK void sdsCacheClean (const void *addr, uint32_t size) {
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  SCB_CleanDCache_by_Addr((volatile void *)addr, (int32_t)size);
+#else
+  (void)addr;
+  (void)size;
+#endif
+}
+
+/**
+  Invalidate data cache for a stream buffer region (default implementation).
+*/
+__WEAK void sdsCacheInvalidate (void *addr, uint32_t size) {
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  // Clean and invalidate: data written to the region by the CPU (SDSIO interface without DMA) is not lost.
+  SCB_CleanInvalidateDCache_by_Addr((volatile void *)addr, (int32_t)size);
+#else
+  (void)addr;
+  (void)size;
+#endif
+}
+
+// Data cache maintenance of a buffer region (segments extended to whole cache lines).
+//  Stream buffers are aligned to and a multiple of the cache line size, so extended segments stay within the buffer.
+//  invalidate: 0 = clean (before data is written to SDSIO), 1 = invalidate (after data is read from SDSIO).
+static void sdsCacheRegion (const sdsBufferRegion_t *region, uint32_t invalidate) {
+  uint8_t  *buf[2];
+  uint32_t  size[2];
+  uintptr_t addr, end;
+  uint32_t  n;
+
+  buf[0]  = region->buf1;
+  size[0] = region->size1;
+  buf[1]  = region->buf2;
+  size[1] = region->size2;
+
+  for (n = 0U; n < 2U; n++) {
+    if (size[n] == 0U) {
+      continue;
+    }
+    addr = (uintptr_t)buf[n] & ~(uintptr_t)(SDS_CACHE_LINE_SIZE - 1U);
+    end  = ((uintptr_t)buf[n] + size[n] + (SDS_CACHE_LINE_SIZE - 1U)) & ~(uintptr_t)(SDS_CACHE_LINE_SIZE - 1U);
+    if (invalidate != 0U) {
+      sdsCacheInvalidate((void *)addr, (uint32_t)(end - addr));
+    } else {
+      sdsCacheClean((const void *)addr, (uint32_t)(end - addr));
+    }
+  }
+}
+
+#endif
+
+// Check end of stream (read mode): end of stream is reached and the SDS Stream Buffer is empty.
+//  eos: SDS_STREAM_EOS flag loaded before the record index was updated.
+static uint32_t sdsIndexEos (sdsStream_t *stream, uint32_t eos) {
+  return (((eos != 0U) && (sdsBufferGetCount(stream->sds_buffer) == 0)) ? 1U : 0U);
+}
+
+// Release the record retained by sdsReadAligned (read mode).
+//  The record has already been returned, so the other read functions continue with the following record.
+static void sdsIndexRelease (sdsStream_t *stream) {
+
+  if (stream->rec_held != 0U) {
+    sdsBufferReadCommit(stream->sds_buffer, HEAD_SIZE + stream->rec_index[stream->rec_out % SDS_RECORD_INDEX_SIZE].size);
+    stream->rec_out++;
+    stream->rec_held = 0U;
+    if ((stream->buf_size - sdsBufferGetCount(stream->sds_buffer)) >= stream->threshold) {
+      sdsSignal(stream);
+    }
+  }
+}
+
+// Update SDSIO transfer statistics.
+//  start: system timer count at the start of the transfer.
+static void sdsStatsIo (sdsStream_t *stream, uint32_t start) {
+  uint32_t time, val, n;
+
+  // Transfer time in microseconds.
+  time = 0U;
+  if (sdsSysTimerFreq != 0U) {
+    time = (uint32_t)(((uint64_t)(osKernelGetSysTimerCount() - start) * 1000000U) / sdsSysTimerFreq);
+  }
+
+  // Histogram bin: log2 of transfer time (limited to the last bin).
+  n = 0U;
+  for (val = time >> 1; (val != 0U) && (n < (SDS_STATS_HIST_SIZE - 1U)); val >>= 1) {
+    n++;
+  }
+
+  stream->stats.io_cnt++;
+  stream->stats.io_time += time;
+  stream->stats.io_hist[n]++;
+}
+
+// Flight recorder: prepare writing of a record (called by the writing thread before the free space is checked).
+//  While the recorder is armed, the oldest whole records are dropped until size bytes are free in the buffer.
+//  While the captured window is transferred, the end of the window is detected from the record timeslot.
+static void sdsRecorderWrite (sdsStream_t *stream, uint32_t timeslot, uint32_t size) {
+  sdsBufferRegion_t region;
+  dataBlockHead_t   head;
+  uint32_t          fr_state, count, cnt_in;
+
+  fr_state = atomic_ld32((uint32_t *)&stream->fr_state);
+  if (fr_state == SDS_RECORDER_CAPTURE) {
+    if ((int32_t)(timeslot - stream->fr_end) > 0) {
+      // Record is after the end of the captured window: captured data ends before this record.
+      sdsBufferGetCounters(stream->sds_buffer, &cnt_in, NULL);
+      stream->fr_stop = cnt_in;
+      atomic_st32((uint32_t *)&stream->fr_state, SDS_RECORDER_STOP);
+      sdsSignal(stream);
+    }
+  } else if (fr_state != SDS_RECORDER_STOP) {
+    // Announce dropping before the state is checked again: sdsThread does not start the capture
+    // while records are dropped and records are not dropped once the capture is started.
+    atomic_st32((uint32_t *)&stream->fr_drop, 1U);
+    if (atomic_ld32((uint32_t *)&stream->fr_state) <= SDS_RECORDER_TRIGGER) {
+      // Drop oldest whole records (header + data block) until the new record fits into the buffer.
+      count = (uint32_t)sdsBufferGetCount(stream->sds_buffer);
+      while ((count != 0U) && ((stream->buf_size - count) < size)) {
+        sdsBufferReadAcquire(stream->sds_buffer, 0U, HEAD_SIZE, &region);
+        sdsRegionRead(&region, &head);
+        sdsBufferReadCommit(stream->sds_buffer, HEAD_SIZE + head.data_size);
+        count -= HEAD_SIZE + head.data_size;
+      }
+    }
+    atomic_st32((uint32_t *)&stream->fr_drop, 0U);
+  }
+
+  // Timeslot of the last record is the reference for sdsTrigger.
+  atomic_st32((uint32_t *)&stream->fr_last, timeslot);
+}
+
+// Flight recorder: drop whole records before the captured window (called by sdsThread when the capture starts).
+static void sdsRecorderTrim (sdsStream_t *stream) {
+  sdsBufferRegion_t region;
+  dataBlockHead_t   head;
+  uint32_t          count;
+
+  count = (uint32_t)sdsBufferGetCount(stream->sds_buffer);
+  while (count >= HEAD_SIZE) {
+    sdsBufferReadAcquire(stream->sds_buffer, 0U, HEAD_SIZE, &region);
+    sdsRegionRead(&region, &head);
+    if ((count < (HEAD_SIZE + head.data_size)) || ((int32_t)(head.timeslot - stream->fr_begin) >= 0)) {
+      // Record is not complete yet or is within the captured window.
+      break;
+    }
+    sdsBufferReadCommit(stream->sds_buffer, HEAD_SIZE + head.data_size);
+    count -= HEAD_SIZE + head.data_size;
+  }
+}
+
 // Write Handler.
-static void sdsWriteHandler (sdsStream_t *stream) {
-  uint32_t bytes_remaining, bytes_to_transfer, bytes_transferred, state;
-  int32_t  sdsio_ret;
+//  Transfers up to one quantum of data from the SDS Stream Buffer to the SDSIO interface.
+//  Return: 1 when stream has more data to be processed or 0 otherwise.
+static uint32_t sdsWriteHandler (sdsStream_t *stream) {
+  uint32_t          bytes_remaining, bytes_to_transfer, bytes_transferred, state;
+  uint32_t          count, start, fr_state, cnt_out;
+  uint32_t          limit          = 0xFFFFFFFFU;
+  uint32_t          bytes_released = 0U;
+  uint32_t          more  = 0U;
+  uint32_t          error = 0U;
+  int32_t           sdsio_ret;
+  sdsBufferRegion_t region;
+  sdsioVec_t        vec[2];
 
   if ((stream->flags & SDS_STREAM_HALT) != 0U) {
     // The state of the stream is either closing or inactive.
     // Closing state has been processed by sdsThread. Exit the function.
-    return;
+    return 0U;
   }
 
   state = stream->state;
 
-  // Get number of data bytes in the stream buffer.
+  fr_state = SDS_RECORDER_ARMED;
+  if (stream->recorder != 0U) {
+    // Flight recorder: only the captured window is transferred (regardless of threshold and latency).
+    fr_state = atomic_ld32((uint32_t *)&stream->fr_state);
+    if (fr_state <= SDS_RECORDER_TRIGGER) {
+      if (state != SDS_STREAM_STATE_CLOSING) {
+        // Recorder is armed: data is not transferred.
+        return 0U;
+      }
+      // Discard data which has not been captured (write operations have left the stream).
+      sdsBufferClear(stream->sds_buffer);
+    } else {
+      if ((stream->flags & SDS_STREAM_CAPTURE) == 0U) {
+        if (atomic_ld32((uint32_t *)&stream->fr_drop) != 0U) {
+          // Writing thread is dropping records: start the capture in the next scheduling step.
+          return 1U;
+        }
+        // Start the capture: drop records before the captured window.
+        sdsRecorderTrim(stream);
+        stream->flags |= SDS_STREAM_CAPTURE;
+      }
+      if (fr_state == SDS_RECORDER_STOP) {
+        // Transfer data up to the end of the captured window.
+        sdsBufferGetCounters(stream->sds_buffer, NULL, &cnt_out);
+        limit = stream->fr_stop - cnt_out;
+      }
+    }
+  } else if ((state != SDS_STREAM_STATE_CLOSING) && (stream->latency != 0U) && ((stream->flags & SDS_STREAM_FLUSH) == 0U)) {
+    // Check if latency timer is used and no transfer is in progress.
+    count = (uint32_t)sdsBufferGetCount(stream->sds_buffer);
+    if (count == 0U) {
+      // No data in the stream buffer: stop latency timer.
+      stream->flags &= ~SDS_STREAM_TIMER;
+      return 0U;
+    }
+    if ((count < stream->threshold) && (atomic_ld32((uint32_t *)&stream->flush) == 0U)) {
+      if ((stream->flags & SDS_STREAM_TIMER) == 0U) {
+        // Start latency timer for the data in the stream buffer.
+        stream->deadline = osKernelGetTickCount() + stream->latency;
+        sdsTimerStart(stream);
+        return 0U;
+      }
+      if ((int32_t)(osKernelGetTickCount() - stream->deadline) < 0) {
+        // Latency timer is running and has not expired yet.
+        return 0U;
+      }
+    }
+    // Threshold reached, flush requested or latency timer expired: transfer all data from the stream buffer.
+    stream->flags |= SDS_STREAM_FLUSH;
+  }
+
+  // Stop latency timer and clear flush request: data written up to this point is transferred.
+  stream->flags &= ~SDS_STREAM_TIMER;
+  if (stream->flush != 0U) {
+    atomic_st32((uint32_t *)&stream->flush, 0U);
+  }
+
+  // Get number of data bytes in the stream buffer (limited to the stream quantum and the captured window).
   bytes_remaining = sdsBufferGetCount(stream->sds_buffer);
+  if (bytes_remaining > stream->quantum) {
+    bytes_remaining = stream->quantum;
+  }
+  if (bytes_remaining > limit) {
+    bytes_remaining = limit;
+  }
 
   while (bytes_remaining != 0U) {
     bytes_to_transfer = bytes_remaining;
-    if (bytes_to_transfer > sizeof(sdsDataBlockBuf)) {
-      // Adjust number of bytes to transfer to size of intermediate buffer, so that data fits into the buffer.
-      bytes_to_transfer = sizeof(sdsDataBlockBuf);
+    if (bytes_to_transfer > stream->transfer_size) {
+      // Limit number of bytes to transfer to the SDSIO transfer size.
+      bytes_to_transfer = stream->transfer_size;
     }
 
-    // Read data from the SDS Stream Buffer to intermediate buffer.
-    sdsBufferRead(stream->sds_buffer, sdsDataBlockBuf, bytes_to_transfer);
-
-    // Write data from intermediate buffer to SDSIO Interface.
-    sdsio_ret = sdsioWrite(stream->sdsio, sdsDataBlockBuf, bytes_to_transfer);
+    // Get data region (one or two segments) in the SDS Stream Buffer.
+    sdsBufferReadAcquire(stream->sds_buffer, 0U, bytes_to_transfer, &region);
+#if (SDS_CACHE_MAINTENANCE != 0)
+    // Write data from the data cache to memory: SDSIO interface may transfer the region with DMA.
+    sdsCacheRegion(&region, 0U);
+#endif
+    vec[0].buf      = region.buf1;
+    vec[0].buf_size = region.size1;
+    vec[1].buf      = region.buf2;
+    vec[1].buf_size = region.size2;
+
+    // Write data directly from the SDS Stream Buffer to SDSIO Interface.
+    start     = osKernelGetSysTimerCount();
+    sdsio_ret = sdsioWritev(stream->sdsio, vec, (region.size2 != 0U) ? 2U : 1U);
+    sdsStatsIo(stream, start);
     if (sdsio_ret >= 0) {
       // Number of bytes written to the SDSIO interface
       bytes_transferred = sdsio_ret;
+      // Release written data from the SDS Stream Buffer.
+      sdsBufferReadCommit(stream->sds_buffer, bytes_transferred);
     } else {
       if (sdsEvent != NULL) {
         // Notify the application about I/O error.
         sdsEvent(stream, SDS_EVENT_ERROR_IO);
       }
+      error = 1U;
       break;
     }
 
     // Update remaining bytes to be transferred.
-    if (state != SDS_STREAM_STATE_CLOSING) {
-      bytes_remaining -= bytes_transferred;
-    } else {
-      // State of the stream is closing. Transfer all available data.
-      bytes_remaining = sdsBufferGetCount(stream->sds_buffer);
+    bytes_remaining -= bytes_transferred;
+    bytes_released  += bytes_transferred;
+  }
+
+  if (bytes_released != 0U) {
+    // Notify threads waiting for free space in the SDS Stream Buffer.
+    osEventFlagsSet(stream->event, SDS_STREAM_EVENT_DATA);
+  }
+
+  count = (uint32_t)sdsBufferGetCount(stream->sds_buffer);
+
+  if ((fr_state == SDS_RECORDER_STOP) && (error == 0U)) {
+    sdsBufferGetCounters(stream->sds_buffer, NULL, &cnt_out);
+    if (cnt_out == stream->fr_stop) {
+      // Captured window is transferred: discard data after the window on close or arm the recorder again.
+      stream->flags &= ~SDS_STREAM_CAPTURE;
+      if (state == SDS_STREAM_STATE_CLOSING) {
+        sdsBufferClear(stream->sds_buffer);
+      } else {
+        atomic_st32((uint32_t *)&stream->fr_state, SDS_RECORDER_ARMED);
+        // Notify threads waiting for space: records are dropped again.
+        osEventFlagsSet(stream->event, SDS_STREAM_EVENT_DATA);
+      }
+      count = 0U;
     }
   }
 
   if (state == SDS_STREAM_STATE_CLOSING) {
-    // State of the stream is closing.
-    // All data has been successfully read from the stream buffer and written to the SDSIO interface.
+    // State of the stream is closing. Transfer all available data.
+    if ((error == 0U) && (count != 0U)) {
+      more = 1U;
+    } else {
+      // All data has been successfully read from the stream buffer and written to the SDSIO interface.
 
-    // Set the internal SDS_STREAM_HALT flag to mark that sdsThread has finished processing the closing state.
-    stream->flags |= SDS_STREAM_HALT;
-    // Notify the thread waiting for the event in the sdsClose function to finalize the closing of the write stream.
-    osEventFlagsSet(sdsCloseEventFlags, 1U << stream->index);
+      // Set the internal SDS_STREAM_HALT flag to mark that sdsThread has finished processing the closing state.
+      stream->flags |= SDS_STREAM_HALT;
+      // Notify the thread waiting for the event in the sdsClose function to finalize the closing of the write stream.
+      osEventFlagsSet(stream->event, SDS_STREAM_EVENT_CLOSE);
+    }
+  } else {
+    // Continue until the SDS Stream Buffer is drained.
+    if ((error == 0U) && (count != 0U)) {
+      more = 1U;
+    } else {
+      // Transfer is completed.
+      stream->flags &= ~SDS_STREAM_FLUSH;
+    }
   }
+
+  return more;
 }
 
 // Read Handler.
-static void sdsReadHandler (sdsStream_t *stream) {
-  uint32_t bytes_remaining, bytes_to_transfer, bytes_transferred;
-  int32_t  sdsio_ret;
+//  Transfers up to one quantum of data from the SDSIO interface to the SDS Stream Buffer.
+//  Return: 1 when stream has more data to be processed or 0 otherwise.
+static uint32_t sdsReadHandler (sdsStream_t *stream) {
+  uint32_t          bytes_remaining, bytes_to_transfer, bytes_transferred, start;
+  uint32_t          bytes_received = 0U;
+  uint32_t          more  = 0U;
+  uint32_t          error = 0U;
+  int32_t           sdsio_ret;
+  sdsBufferRegion_t region;
+  sdsioVec_t        vec[2];
 
   if ((stream->flags & SDS_STREAM_HALT) != 0U) {
     // State of the stream is closing or inactive.
     // Closing state has already been processed by sdsThread. Exit the function.
-    return;
+    return 0U;
   }
   if (stream->state == SDS_STREAM_STATE_CLOSING) {
     // State of the stream is closing. Thread sdsThread has stopped reading data from SDSIO interface.
     // Set the internal SDS_STREAM_HALT flag to mark that sdsThread has finished processing the closing state.
     stream->flags |= SDS_STREAM_HALT;
     // Notify the thread waiting for the event in the sdsClose function to finalize the closing of the read stream.
-    osEventFlagsSet(sdsCloseEventFlags, 1U << stream->index);
-    return;
+    osEventFlagsSet(stream->event, SDS_STREAM_EVENT_CLOSE);
+    return 0U;
+  }
+
+  if (stream->seek != 0U) {
+    // Seek request from sdsSeek: the reading thread waits and does not access the SDS Stream Buffer.
+    // Reposition the SDSIO stream and discard the data read from the previous position.
+    // The stream is left unchanged when the SDSIO interface does not support seek (default sdsioSeek).
+    stream->seek_status = sdsioSeek(stream->sdsio, stream->seek_timeslot);
+    if (stream->seek_status == SDS_OK) {
+      sdsBufferClear(stream->sds_buffer);
+      if ((stream->flags & SDS_STREAM_INITIAL_FILL) != 0U) {
+        // Fill the buffer again before sdsSeek returns (SDS_EVENT_OPEN is not repeated).
+        stream->flags &= (uint8_t)~(SDS_STREAM_INITIAL_FILL | SDS_STREAM_ASYNC);
+      }
+      stream->flags &= (uint8_t)~SDS_STREAM_EOS;
+    }
+    stream->seek   = 0U;
+    // Notify the thread waiting for the event in the sdsSeek function.
+    osEventFlagsSet(stream->event, SDS_STREAM_EVENT_SEEK);
   }
 
-  // Calculate available space in the stream buffer.
+  // Calculate available space in the stream buffer (limited to the stream quantum).
   bytes_remaining = stream->buf_size - sdsBufferGetCount(stream->sds_buffer);
+  if (bytes_remaining > stream->quantum) {
+    bytes_remaining = stream->quantum;
+  }
+
   while (bytes_remaining != 0U) {
     bytes_to_transfer = bytes_remaining;
-    if (bytes_to_transfer > sizeof(sdsDataBlockBuf)) {
-      // Adjust number of bytes to transfer to size of intermediate buffer, so that data fits into the buffer.
-      bytes_to_transfer = sizeof(sdsDataBlockBuf);
+    if (bytes_to_transfer > stream->transfer_size) {
+      // Limit number of bytes to transfer to the SDSIO transfer size.
+      bytes_to_transfer = stream->transfer_size;
     }
 
-    // Read data from the SDSIO Interface to intermediate buffer.
-    sdsio_ret = sdsioRead(stream->sdsio, sdsDataBlockBuf, bytes_to_transfer);
+    // Get free space region (one or two segments) in the SDS Stream Buffer.
+    sdsBufferWriteAcquire(stream->sds_buffer, 0U, bytes_to_transfer, &region);
+#if (SDS_CACHE_MAINTENANCE != 0)
+    // Write dirty cache lines to memory: they are not evicted while SDSIO interface transfers the region with DMA.
+    sdsCacheRegion(&region, 0U);
+#endif
+    vec[0].buf      = region.buf1;
+    vec[0].buf_size = region.size1;
+    vec[1].buf      = region.buf2;
+    vec[1].buf_size = region.size2;
+
+    // Read data from the SDSIO Interface directly to the SDS Stream Buffer.
+    start     = osKernelGetSysTimerCount();
+    sdsio_ret = sdsioReadv(stream->sdsio, vec, (region.size2 != 0U) ? 2U : 1U);
+    sdsStatsIo(stream, start);
+#if (SDS_CACHE_MAINTENANCE != 0)
+    // Discard cache lines of the region: data is read from memory written by the SDSIO interface.
+    sdsCacheRegion(&region, 1U);
+#endif
     if (sdsio_ret > 0) {
       // Number of bytes read from the SDSIO interface
       bytes_transferred = sdsio_ret;
@@ -334,30 +1051,41 @@ static void sdsReadHandler (sdsStream_t *stream) {
       // End of stream reached.
       bytes_transferred = 0U;
       stream->flags |= SDS_STREAM_EOS;
+    } else if (sdsio_ret == 0) {
+      // No data currently available. Retry in the next scheduling step.
+      more = 1U;
+      break;
     } else {
       // Error occurred during reading from the SDSIO interface.
       if (sdsEvent != NULL) {
         // Notify the application about I/O error.
         sdsEvent(stream, SDS_EVENT_ERROR_IO);
       }
+      error = 1U;
       break;
     }
 
     if (bytes_transferred != 0U) {
-      // Write data from intermediate buffer to the SDS Stream Buffer.
-      // Available space in stream buffer has been validated, so write operation is expected to succeed.
-      sdsBufferWrite(stream->sds_buffer, sdsDataBlockBuf, bytes_transferred);
+      // Commit data read into the SDS Stream Buffer.
+      // Available space in stream buffer has been validated, so commit operation is expected to succeed.
+      sdsBufferWriteCommit(stream->sds_buffer, bytes_transferred);
+      bytes_received += bytes_transferred;
     }
 
-    // Check if the stream is in the opening state and the processing of the state is not completed.
-    if ((stream->state == SDS_STREAM_STATE_OPENING) && ((stream->flags & SDS_STREAM_INITIAL_FILL) == 0U)) {
+    // Check if the processing of the opening state is not completed
+    // (stream is in the opening state, or in the read state when opened asynchronously).
+    if ((stream->flags & SDS_STREAM_INITIAL_FILL) == 0U) {
       // Check if SDS Stream Buffer is filled with data from the SDSIO interface (at least to threshold or EOS).
       if ((sdsBufferGetCount(stream->sds_buffer) >= (int32_t)stream->threshold) || ((stream->flags & SDS_STREAM_EOS) != 0U)) {
         // Stream buffer is filled with data from the SDSIO interface.
         // Set the internal SDS_STREAM_INITIAL_FILL flag to mark that sdsReadHandler has finished processing the opening state.
         stream->flags |= SDS_STREAM_INITIAL_FILL;
-        // Notify the thread waiting for the event in the sdsOpen function to finalize the opening of the read stream.
-        osEventFlagsSet(sdsOpenEventFlags, 1U << stream->index);
+        // Notify the thread waiting for the event in the sdsOpen or sdsOpenGroup function to finalize the opening of the read stream.
+        osEventFlagsSet(stream->event, SDS_STREAM_EVENT_OPEN);
+        if (((stream->flags & SDS_STREAM_ASYNC) != 0U) && (sdsEvent != NULL)) {
+          // Notify the application that the stream opened with sdsOpenAsync is filled.
+          sdsEvent(stream, SDS_EVENT_OPEN);
+        }
       }
     }
 
@@ -369,61 +1097,634 @@ static void sdsReadHandler (sdsStream_t *stream) {
       break;
     }
   }
+
+  if ((bytes_received != 0U) || ((stream->flags & SDS_STREAM_EOS) != 0U)) {
+    // Notify threads waiting for data in the SDS Stream Buffer.
+    osEventFlagsSet(stream->event, SDS_STREAM_EVENT_DATA);
+  }
+
+  // Continue until the SDS Stream Buffer is filled or end of stream is reached.
+  if ((error == 0U) && ((stream->flags & SDS_STREAM_EOS) == 0U) &&
+      ((stream->buf_size - sdsBufferGetCount(stream->sds_buffer)) != 0U)) {
+    more = 1U;
+  }
+
+  return more;
+}
+
+// Check latency timers.
+//  Streams with expired latency timer are added to the ready queue.
+//  Stopped timers are removed from the list; timeout is reduced to the time remaining until the next timer expires.
+static void sdsTimerCheck (uint32_t *timeout) {
+  sdsStream_t *stream;
+  uint32_t     tick, n;
+  int32_t      remaining;
+
+  tick = osKernelGetTickCount();
+  n    = 0U;
+  while (n < sdsTimerCount) {
+    stream = psdsStreams[sdsTimerList[n]];
+    if ((stream == NULL) || (stream->state == SDS_STREAM_STATE_INACTIVE) ||
+        ((stream->flags & SDS_STREAM_TIMER) == 0U)) {
+      // Latency timer stopped or stream closed: remove stream from the list.
+      sdsTimerList[n] = sdsTimerList[--sdsTimerCount];
+      continue;
+    }
+    remaining = (int32_t)(stream->deadline - tick);
+    if (remaining <= 0) {
+      // Latency timer expired.
+      sdsReadyPush(stream);
+    } else if ((uint32_t)remaining < *timeout) {
+      *timeout = (uint32_t)remaining;
+    }
+    n++;
+  }
 }
 
 // SDS system thread.
 static __NO_RETURN void sdsThread (void *arg) {
   sdsStream_t *stream;
-  uint32_t     flags, n;
+  uint32_t     timeout;
+  uint32_t     more;
 
   (void)arg;
 
   while (1) {
-    // Wait for threshold event flags.
-    flags = osThreadFlagsWait(SDS_EVENT_FLAG_MASK, osFlagsWaitAny, osWaitForever);
-    if ((flags & osFlagsError) == 0U) {
-      // Process all streams with set flags.
-      for (n = 0U; n < SDS_MAX_STREAMS; n++) {
-        if ((flags & (1U << n)) == 0U) {
-          // The flag is not set for this stream. Moving to the next stream.
-          continue;
-        }
-        // Get stream control block.
-        stream = psdsStreams[n];
-        if (stream == NULL) {
-          // Stream control block is not allocated. Move to next stream.
-          continue;
-        }
-        if (stream->state == SDS_STREAM_STATE_INACTIVE) {
-          // Stream is inactive. Move to the next stream.
-          continue;
-        }
+    // Add streams with expired latency timer to the ready queue.
+    timeout = osWaitForever;
+    sdsTimerCheck(&timeout);
+
+    // Select the stream to be processed in this scheduling step.
+    stream = sdsReadyPop();
+    if (stream == NULL) {
+      // No stream is ready: wait for notification or until the next latency timer expires.
+      osThreadFlagsWait(SDS_THREAD_FLAG_READY, osFlagsWaitAny, timeout);
+      continue;
+    }
 
-        if (stream->mode == SDS_STREAM_MODE_WRITE) {
-          // Write stream.
-          sdsWriteHandler(stream);
-        } else if (stream->mode == SDS_STREAM_MODE_READ) {
-          // Read stream.
-          sdsReadHandler(stream);
+    if (psdsStreams[stream->index] == NULL) {
+      // Stream control block is not allocated.
+      continue;
+    }
+    if (stream->state == SDS_STREAM_STATE_INACTIVE) {
+      // Stream is inactive.
+      continue;
+    }
+
+    // Process one quantum of the stream.
+    more = 0U;
+    if (stream->mode == SDS_STREAM_MODE_WRITE) {
+      // Write stream.
+      more = sdsWriteHandler(stream);
+    } else if (stream->mode == SDS_STREAM_MODE_READ) {
+      // Read stream.
+      more = sdsReadHandler(stream);
+    }
+    if (more != 0U) {
+      // Stream has more data to be processed: add it to the end of its ready queue.
+      sdsReadyPush(stream);
+    }
+  }
+}
+
+// Notify sdsThread about data written to the SDS Stream Buffer.
+//  sdsThread is notified when the amount of data is at or above the threshold, or when the latency timer is used
+//  and data has been written to an empty buffer (sdsThread starts the latency timer).
+//  In flight recorder mode sdsThread is notified on every write while the captured window is transferred.
+static void sdsWriteNotify (sdsStream_t *stream, uint32_t size) {
+  uint32_t count;
+
+  if (stream->recorder != 0U) {
+    if (atomic_ld32((uint32_t *)&stream->fr_state) > SDS_RECORDER_TRIGGER) {
+      sdsSignal(stream);
+    }
+    return;
+  }
+
+  count = (uint32_t)sdsBufferGetCount(stream->sds_buffer);
+  if ((count >= stream->threshold) || ((stream->latency != 0U) && (count <= size))) {
+    sdsSignal(stream);
+  }
+}
+
+// Request sdsThread to transfer all data from the SDS Stream Buffer (also below the threshold).
+static void sdsFlushRequest (sdsStream_t *stream) {
+
+  atomic_st32((uint32_t *)&stream->flush, 1U);
+  sdsSignal(stream);
+}
+
+// Wait until sdsThread has transferred data of the stream (write mode: space is freed, read mode: data is filled).
+//  tick: tick count at the start of the operation, timeout: timeout in kernel ticks.
+//  Return: 1 when data has been transferred or 0 when the timeout expired or an error occurred.
+static uint32_t sdsWaitData (sdsStream_t *stream, uint32_t tick, uint32_t timeout) {
+  uint32_t flags, elapsed;
+
+  if (timeout == 0U) {
+    return 0U;
+  }
+  if (timeout != osWaitForever) {
+    elapsed = osKernelGetTickCount() - tick;
+    if (elapsed >= timeout) {
+      // Timeout expired.
+      return 0U;
+    }
+    timeout -= elapsed;
+  }
+  flags = osEventFlagsWait(stream->event, SDS_STREAM_EVENT_DATA, osFlagsWaitAny | osFlagsNoClear, timeout);
+
+  return (((flags & osFlagsError) == 0U) ? 1U : 0U);
+}
+
+// Add value to a statistics counter (atomic in multi-producer mode, where writers update the counters concurrently).
+static void sdsStatsAdd (sdsStream_t *stream, uint32_t *counter, uint32_t val) {
+
+  if (stream->multi != 0U) {
+    atomic_add32(counter, (int32_t)val);
+  } else {
+    *counter += val;
+  }
+}
+
+// Write record (header + data block segments) to the SDS Stream Buffer in multi-producer mode.
+//  Space for the whole record is reserved atomically, so concurrent writers (also ISRs) append whole records
+//  in the order in which the space is reserved.
+//  Return: 1 when the record is written or 0 when there is insufficient space.
+static uint32_t sdsWriteMulti (sdsStream_t *stream, uint32_t timeslot, const sdsVec_t *vec, uint32_t vec_cnt, uint32_t size) {
+  sdsBufferRegion_t region;
+  dataBlockHead_t   head;
+  uint32_t          offset, n;
+
+  if (sdsBufferReserve(stream->sds_buffer, HEAD_SIZE + size, &region) <= 0) {
+    return 0U;
+  }
+
+  // Header: timeslot, data block size.
+  head.timeslot  = timeslot;
+  head.data_size = size;
+
+  // Write header and data block segments to the reserved space and publish the record.
+  offset = sdsRegionWriteAt(&region, 0U, &head, HEAD_SIZE);
+  for (n = 0U; n < vec_cnt; n++) {
+    if (vec[n].buf_size != 0U) {
+      offset = sdsRegionWriteAt(&region, offset, vec[n].buf, vec[n].buf_size);
+    }
+  }
+  sdsBufferReserveCommit(stream->sds_buffer);
+
+  return 1U;
+}
+
+// Write data block to the SDS Stream Buffer (non-blocking).
+static int32_t sdsWriteBlock (sdsStream_t *stream, uint32_t timeslot, const void *buf, uint32_t buf_size) {
+  int32_t         ret      = SDS_ERROR;
+  uint32_t        written  = 0U;
+  dataBlockHead_t head;
+  sdsVec_t        vec;
+
+  if (sdsEnter(stream, SDS_STREAM_STATE_WRITE) == 0U) {
+    // Stream is not in writing state. Exit the function.
+    return SDS_ERROR;
+  }
+  if ((stream->head.data_size != 0U) || (stream->chunk != 0U)) {
+    // Data block is acquired or a record is written in chunks. Exit the function.
+    sdsLeave(stream);
+    return SDS_ERROR;
+  }
+
+  // Verify if parameters are valid.
+  if ((buf != NULL) && (buf_size != 0U)) {
+
+    if (stream->recorder != 0U) {
+      // Flight recorder: make space for the record.
+      sdsRecorderWrite(stream, timeslot, HEAD_SIZE + buf_size);
+    }
+
+    if (stream->multi != 0U) {
+      // Multi-producer mode: write record to space reserved atomically.
+      vec.buf      = buf;
+      vec.buf_size = buf_size;
+      written = sdsWriteMulti(stream, timeslot, &vec, 1U, buf_size);
+    } else if ((buf_size + sizeof(dataBlockHead_t)) <= (stream->buf_size - sdsBufferGetCount(stream->sds_buffer))) {
+      // Header + data fits into the buffer.
+      // Header: timeslot, data block size.
+      head.timeslot  = timeslot;
+      head.data_size = buf_size;
+
+      // Write header and data block: Buffer size has been validated, so write operations are expected to succeed.
+      sdsBufferWrite(stream->sds_buffer, &head, sizeof(dataBlockHead_t));
+      sdsBufferWrite(stream->sds_buffer, buf, buf_size);
+      written = 1U;
+    }
+
+    if (written != 0U) {
+      ret = (int32_t)buf_size;
+      sdsStatsAdd(stream, &stream->stats.records, 1U);
+
+      // Notify the sdsThread by setting the corresponding thread flag to process the stream.
+      sdsWriteNotify(stream, HEAD_SIZE + buf_size);
+    } else {
+      // Insufficient space in the stream buffer.
+      // Notify the sdsThread to transfer data from the SDS Stream Buffer (also below the threshold).
+      if (sdsBufferGetCount(stream->sds_buffer) != 0) {
+        sdsFlushRequest(stream);
+      }
+      ret = SDS_NO_SPACE;
+    }
+  } else {
+    ret = SDS_ERROR_PARAMETER;
+  }
+
+  // Leave stream operation.
+  sdsLeave(stream);
+
+  return ret;
+}
+
+// Write data of the record written in chunks to the SDS Stream Buffer (non-blocking).
+//  Return: number of bytes written (0 when the buffer is full) or a negative value on error.
+static int32_t sdsWriteChunkBlock (sdsStream_t *stream, const void *buf, uint32_t buf_size) {
+  int32_t  ret = SDS_ERROR;
+  uint32_t num;
+
+  if (sdsEnter(stream, SDS_STREAM_STATE_WRITE) == 0U) {
+    // Stream is not in writing state. Exit the function.
+    return SDS_ERROR;
+  }
+
+  if (stream->chunk == 0U) {
+    // No record is written in chunks.
+    ret = SDS_ERROR;
+  } else if (buf_size > stream->chunk_size) {
+    // Data exceeds the record size given to sdsWriteBegin.
+    ret = SDS_ERROR_PARAMETER;
+  } else {
+    // Write as much data as fits into the buffer: sdsThread transfers the record while it is written.
+    num = stream->buf_size - (uint32_t)sdsBufferGetCount(stream->sds_buffer);
+    if (num > buf_size) {
+      num = buf_size;
+    }
+    if (num != 0U) {
+      sdsBufferWrite(stream->sds_buffer, buf, num);
+      stream->chunk_size -= num;
+
+      // Notify the sdsThread by setting the corresponding thread flag to process the stream.
+      sdsWriteNotify(stream, num);
+    }
+    ret = (int32_t)num;
+  }
+
+  // Leave stream operation.
+  sdsLeave(stream);
+
+  return ret;
+}
+
+// Pad the rest of the record written in chunks with zeros in the SDS Stream Buffer (non-blocking).
+//  The record is completed when the whole data block is written.
+//  Return: number of bytes padded (0 when the buffer is full) or a negative value on error.
+static int32_t sdsWritePadBlock (sdsStream_t *stream) {
+  sdsBufferRegion_t region;
+  int32_t           ret = SDS_ERROR;
+  uint32_t          num;
+
+  if (sdsEnter(stream, SDS_STREAM_STATE_WRITE) == 0U) {
+    // Stream is not in writing state. Exit the function.
+    return SDS_ERROR;
+  }
+
+  if (stream->chunk == 0U) {
+    // No record is written in chunks.
+    ret = SDS_ERROR;
+  } else {
+    num = stream->buf_size - (uint32_t)sdsBufferGetCount(stream->sds_buffer);
+    if (num > stream->chunk_size) {
+      num = stream->chunk_size;
+    }
+    if (num != 0U) {
+      // Fill free space region (one or two segments) with zeros and commit it.
+      sdsBufferWriteAcquire(stream->sds_buffer, 0U, num, &region);
+      memset(region.buf1, 0, region.size1);
+      if (region.size2 != 0U) {
+        memset(region.buf2, 0, region.size2);
+      }
+      sdsBufferWriteCommit(stream->sds_buffer, num);
+      stream->chunk_size -= num;
+
+      // Notify the sdsThread by setting the corresponding thread flag to process the stream.
+      sdsWriteNotify(stream, num);
+    }
+    if (stream->chunk_size == 0U) {
+      // Record is complete.
+      stream->chunk = 0U;
+      stream->stats.records++;
+    }
+    ret = (int32_t)num;
+  }
+
+  // Leave stream operation.
+  sdsLeave(stream);
+
+  return ret;
+}
+
+// Complete the record written in chunks: pad the rest of the data block with zeros,
+// so that the SDS file contains the whole record as announced in its header.
+//  The timeout restarts whenever padding data is written.
+//  Return: SDS_OK when the record is completed, SDS_ERROR_TIMEOUT or SDS_ERROR otherwise.
+static int32_t sdsWritePad (sdsStream_t *stream, uint32_t timeout) {
+  int32_t  ret;
+  uint32_t tick;
+
+  tick = osKernelGetTickCount();
+
+  while (1) {
+    // Clear data event before the available space is checked, so that a transfer done by sdsThread is not missed.
+    osEventFlagsClear(stream->event, SDS_STREAM_EVENT_DATA);
+
+    ret = sdsWritePadBlock(stream);
+    if (ret < 0) {
+      break;
+    }
+    if (stream->chunk == 0U) {
+      // Record is complete.
+      ret = SDS_OK;
+      break;
+    }
+    if (ret != 0) {
+      // Buffer is full: transfer data also when the padding data is below the threshold.
+      sdsFlushRequest(stream);
+      tick = osKernelGetTickCount();
+    }
+
+    // Wait until sdsThread has transferred data from the SDS Stream Buffer.
+    if (sdsWaitData(stream, tick, timeout) == 0U) {
+      ret = SDS_ERROR_TIMEOUT;
+      break;
+    }
+  }
+
+  return ret;
+}
+
+// Read data of the record read in chunks from the SDS Stream Buffer (non-blocking).
+//  Return: number of bytes read (0 when the buffer is empty), SDS_EOS or a negative value on error.
+static int32_t sdsReadChunkBlock (sdsStream_t *stream, void *buf, uint32_t buf_size) {
+  int32_t  ret = SDS_ERROR;
+  uint32_t num, eos;
+
+  if (sdsEnter(stream, SDS_STREAM_STATE_READ) == 0U) {
+    // Stream is not in read state. Exit the function.
+    return SDS_ERROR;
+  }
+
+  if (stream->chunk == 0U) {
+    // No record is read in chunks.
+    ret = SDS_ERROR;
+  } else {
+    // Save eos flag.
+    eos = stream->flags & SDS_STREAM_EOS;
+
+    // Read the data which is available in the buffer, up to the end of the record.
+    num = (uint32_t)sdsBufferGetCount(stream->sds_buffer);
+    if (num > stream->chunk_size) {
+      num = stream->chunk_size;
+    }
+    if (num > buf_size) {
+      num = buf_size;
+    }
+    if (num != 0U) {
+      sdsBufferRead(stream->sds_buffer, buf, num);
+      stream->chunk_size -= num;
+      ret = (int32_t)num;
+
+      // If free space in the SDS Stream Buffer is at or above the threshold,
+      // notify the sdsThread by setting the corresponding thread flag to process the stream.
+      if ((stream->buf_size - sdsBufferGetCount(stream->sds_buffer)) >= stream->threshold) {
+        sdsSignal(stream);
+      }
+    } else if ((stream->chunk_size != 0U) && (sdsIndexEos(stream, eos) != 0U)) {
+      // End of stream reached before the end of the record.
+      ret = SDS_EOS;
+    } else {
+      ret = 0;
+    }
+  }
+
+  // Leave stream operation.
+  sdsLeave(stream);
+
+  return ret;
+}
+
+// Read data block from the SDS Stream Buffer (non-blocking).
+static int32_t sdsReadBlock (sdsStream_t *stream, uint32_t *timeslot, void *buf, uint32_t buf_size) {
+  sdsBufferRegion_t region;
+  sdsRecordIndex_t *rec;
+  int32_t           ret = SDS_ERROR;
+  uint32_t          eos;
+
+  if (sdsEnter(stream, SDS_STREAM_STATE_READ) == 0U) {
+    // Stream is not in read state. Exit the function.
+    return SDS_ERROR;
+  }
+  if (stream->chunk != 0U) {
+    // Record is read in chunks. Exit the function.
+    sdsLeave(stream);
+    return SDS_ERROR;
+  }
+
+  // Verify if parameters are valid.
+  if ((buf != NULL) && (buf_size != 0U)) {
+    // Release the record retained by sdsReadAligned.
+    sdsIndexRelease(stream);
+
+    // Save eos flag.
+    eos = stream->flags & SDS_STREAM_EOS;
+
+    // Check if a complete data block is available (record index is not empty).
+    if (sdsIndexUpdate(stream) != 0U) {
+      rec = &stream->rec_index[stream->rec_out % SDS_RECORD_INDEX_SIZE];
+      // Check if whole data block fits into the provided buffer.
+      if (rec->size > buf_size) {
+        // Provided buffer is too small to read the data block.
+        ret = SDS_ERROR_PARAMETER;
+      } else {
+        // Read data block from SDS Stream Buffer (skip the header) and release the record.
+        sdsBufferReadAcquire(stream->sds_buffer, HEAD_SIZE, rec->size, &region);
+        sdsRegionRead(&region, buf);
+        sdsBufferReadCommit(stream->sds_buffer, HEAD_SIZE + rec->size);
+        stream->rec_out++;
+        stream->stats.records++;
+
+        // Get timeslot from the record index.
+        if (timeslot != NULL) {
+          *timeslot = rec->timeslot;
+        }
+        ret = (int32_t)rec->size;
+
+        // If free space in the SDS Stream Buffer is at or above the threshold,
+        // notify the sdsThread by setting the corresponding thread flag to process the stream.
+        if ((stream->buf_size - sdsBufferGetCount(stream->sds_buffer)) >= stream->threshold) {
+          sdsSignal(stream);
         }
       }
+    } else if (sdsIndexEos(stream, eos) != 0U) {
+      ret = SDS_EOS;
+    } else {
+      // Whole header or data block is not available in the SDS Stream Buffer.
+      ret = SDS_NO_DATA;
+    }
+  } else {
+    ret = SDS_ERROR_PARAMETER;
+  }
+
+  // Leave stream operation.
+  sdsLeave(stream);
+
+  return ret;
+}
+
+// Timeslot-aligned read of one stream (non-blocking).
+//  Releases records which are followed by another record at or before the timeslot, then reads the record
+//  at or nearest before the timeslot once the following record is known to be later, the stream has ended
+//  or the SDS Stream Buffer is full. The record read is retained and read again for later timeslots
+//  until a following record at or before the timeslot is available (not when the buffer is full).
+//  Return: number of bytes read, 0 when the first record is later than the timeslot,
+//          SDS_NO_DATA when more data is needed, SDS_EOS or a negative value on error.
+static int32_t sdsReadAlignedBlock (sdsStream_t *stream, uint32_t timeslot, sdsAlignedRecord_t *rec) {
+  sdsBufferRegion_t region;
+  sdsRecordIndex_t *cur;
+  dataBlockHead_t   head;
+  int32_t           ret;
+  uint32_t          eos, cnt, cnt_in, cnt_out, next, known, full;
+  uint32_t          size = 0U;
+
+  if (sdsEnter(stream, SDS_STREAM_STATE_READ) == 0U) {
+    // Stream is not in read state. Exit the function.
+    return SDS_ERROR;
+  }
+  if (stream->chunk != 0U) {
+    // Record is read in chunks. Exit the function.
+    sdsLeave(stream);
+    return SDS_ERROR;
+  }
+
+  // Save eos flag.
+  eos = stream->flags & SDS_STREAM_EOS;
+
+  while (1) {
+    cnt = sdsIndexUpdate(stream);
+    if (cnt == 0U) {
+      // No complete data block is available.
+      ret = (sdsIndexEos(stream, eos) != 0U) ? SDS_EOS : SDS_NO_DATA;
+      break;
+    }
+    cur = &stream->rec_index[stream->rec_out % SDS_RECORD_INDEX_SIZE];
+    if ((int32_t)(cur->timeslot - timeslot) > 0) {
+      // Next record is later than the timeslot: stream has no record for the timeslot.
+      ret = 0;
+      break;
+    }
+
+    // Get timeslot of the following record from the record index or from the next header in the buffer.
+    sdsBufferGetCounters(stream->sds_buffer, &cnt_in, &cnt_out);
+    known = 0U;
+    next  = 0U;
+    if (cnt >= 2U) {
+      next  = stream->rec_index[(stream->rec_out + 1U) % SDS_RECORD_INDEX_SIZE].timeslot;
+      known = 1U;
+    } else if ((cnt_in - stream->rec_pos) >= HEAD_SIZE) {
+      sdsBufferReadAcquire(stream->sds_buffer, stream->rec_pos - cnt_out, HEAD_SIZE, &region);
+      sdsRegionRead(&region, &head);
+      next  = head.timeslot;
+      known = 1U;
+    }
+
+    if ((known != 0U) && ((int32_t)(next - timeslot) <= 0)) {
+      // Following record is also at or before the timeslot: release the current record without copying the data block.
+      size += HEAD_SIZE + cur->size;
+      sdsBufferReadCommit(stream->sds_buffer, HEAD_SIZE + cur->size);
+      stream->rec_out++;
+      stream->rec_held = 0U;
+      continue;
+    }
+    if ((known == 0U) && (eos != 0U) && (cnt_in == stream->rec_pos) && (stream->rec_held != 0U)) {
+      // Last record of the stream has already been read: release it.
+      size += HEAD_SIZE + cur->size;
+      sdsBufferReadCommit(stream->sds_buffer, HEAD_SIZE + cur->size);
+      stream->rec_out++;
+      stream->rec_held = 0U;
+      ret = SDS_EOS;
+      break;
+    }
+    full = 0U;
+    if ((known == 0U) && ((eos == 0U) || (cnt_in != stream->rec_pos))) {
+      if (sdsBufferGetCount(stream->sds_buffer) != (int32_t)stream->buf_size) {
+        // Following record is not available yet and the end of stream is not reached.
+        ret = SDS_NO_DATA;
+        break;
+      }
+      // SDS Stream Buffer is full and cannot receive the next header: the record is read without being retained.
+      full = 1U;
+    }
+
+    // Current record is the record at or nearest before the timeslot: read it and retain it for later timeslots.
+    if (cur->size > rec->buf_size) {
+      // Provided buffer is too small to read the data block.
+      ret = SDS_ERROR_PARAMETER;
+      break;
+    }
+    sdsBufferReadAcquire(stream->sds_buffer, HEAD_SIZE, cur->size, &region);
+    sdsRegionRead(&region, rec->buf);
+    if (stream->rec_held == 0U) {
+      stream->rec_held = 1U;
+      stream->stats.records++;
+    }
+    if (full != 0U) {
+      size += HEAD_SIZE + cur->size;
+      sdsBufferReadCommit(stream->sds_buffer, HEAD_SIZE + cur->size);
+      stream->rec_out++;
+      stream->rec_held = 0U;
+    }
+    rec->timeslot = cur->timeslot;
+    ret = (int32_t)cur->size;
+    break;
+  }
+
+  if (size != 0U) {
+    // If free space in the SDS Stream Buffer is at or above the threshold,
+    // notify the sdsThread by setting the corresponding thread flag to process the stream.
+    if ((stream->buf_size - sdsBufferGetCount(stream->sds_buffer)) >= stream->threshold) {
+      sdsSignal(stream);
     }
   }
+
+  // Leave stream operation.
+  sdsLeave(stream);
+
+  return ret;
 }
 
 /**
   Initialize SDS system.
 */
 int32_t sdsInit (sdsEvent_t event_cb) {
-  int32_t ret = SDS_OK;
+  int32_t  ret = SDS_OK;
+  uint32_t n;
 
   if (sdsInitialized != 0U) {
     // The SDS system is already initialized.
     return SDS_OK;
   }
 
-  // Reset an array of pointers to stream control blocks.
+  // Reset an array of pointers to stream control blocks, ready queues and latency timer list.
   memset(psdsStreams, 0, sizeof(psdsStreams));
+  memset(sdsReadyQueue, 0, sizeof(sdsReadyQueue));
+  sdsTimerCount = 0U;
+
+  // Get system timer frequency for statistics.
+  sdsSysTimerFreq = osKernelGetSysTimerFreq();
 
   // Initialize SDSIO interface.
   ret = sdsioInit();
@@ -436,22 +1737,9 @@ int32_t sdsInit (sdsEvent_t event_cb) {
     }
   }
 
-  // Create open event flags.
-  if (ret == SDS_OK) {
-    sdsOpenEventFlags = osEventFlagsNew(NULL);
-    if (sdsOpenEventFlags == NULL) {
-      SDS_PRINTF("SDS initialization failed to create necessary event flags!\n");
-      ret = SDS_ERROR;
-    }
-  }
-
-  // Create close event flags.
-  if (ret == SDS_OK) {
-    sdsCloseEventFlags = osEventFlagsNew(NULL);
-    if (sdsCloseEventFlags == NULL) {
-      SDS_PRINTF("SDS initialization failed to create necessary event flags!\n");
-      ret = SDS_ERROR;
-    }
+  // Reset ready queue state of stream control blocks (stream event flags are created when a stream is opened).
+  for (n = 0U; n < SDS_MAX_STREAMS; n++) {
+    sdsStreams[n].queued = 0U;
   }
 
   // Set event callback.
@@ -461,16 +1749,10 @@ int32_t sdsInit (sdsEvent_t event_cb) {
     sdsInitialized = 1U;
   } else {
     // Initialization failed:
-    // Terminate thread, delete event flags, and uninitialize SDSIO interface.
+    // Terminate thread and uninitialize SDSIO interface.
     if (sdsThreadId != NULL) {
       osThreadTerminate(sdsThreadId);
     }
-    if (sdsOpenEventFlags != NULL) {
-      osEventFlagsDelete(sdsOpenEventFlags);
-    }
-    if (sdsCloseEventFlags != NULL) {
-      osEventFlagsDelete(sdsCloseEventFlags);
-    }
     sdsioUninit();
   }
 
@@ -481,6 +1763,7 @@ int32_t sdsInit (sdsEvent_t event_cb) {
   Uninitialize SDS system.
 */
 int32_t sdsUninit (void) {
+  uint32_t n;
 
   if (sdsInitialized == 0U) {
     // SDS system not yet initialized.
@@ -490,10 +1773,14 @@ int32_t sdsUninit (void) {
   // Clear initialization flag.
   sdsInitialized = 0U;
 
-  // Terminate thread and delete event flags.
+  // Terminate thread and delete event flags of streams which are still open.
   osThreadTerminate(sdsThreadId);
-  osEventFlagsDelete(sdsOpenEventFlags);
-  osEventFlagsDelete(sdsCloseEventFlags);
+  for (n = 0U; n < SDS_MAX_STREAMS; n++) {
+    if (sdsStreams[n].event != NULL) {
+      osEventFlagsDelete(sdsStreams[n].event);
+      sdsStreams[n].event = NULL;
+    }
+  }
 
   // Clear event callback.
   sdsEvent = NULL;
@@ -504,25 +1791,23 @@ int32_t sdsUninit (void) {
   return SDS_OK;
 }
 
-// SDS functions
-
-/**
-  Open SDS stream.
-*/
-sdsId_t sdsOpen (const char *name, sdsMode_t mode, void *buf, uint32_t buf_size) {
+// Prepare opening of a stream: allocate control block and open SDS Stream Buffer.
+//  The control block remains locked until opening is completed by sdsOpenComplete.
+//  Return: pointer to stream control block or NULL on error.
+static sdsStream_t * sdsOpenPrepare (const char *name, sdsMode_t mode, void *buf, uint32_t buf_size) {
   sdsStream_t *stream = NULL;
-  uint32_t     index, flags;
-  int32_t      err = SDS_OK;
-
-  if (sdsInitialized == 0U) {
-    // The SDS system is not initialized. Exiting the function.
-    return NULL;
-  }
+  uint32_t     index;
 
   if ((name == NULL) || (buf == NULL) || (buf_size == 0U)) {
     // If any parameter is invalid. Exit the function.
     return NULL;
   }
+#if (SDS_CACHE_MAINTENANCE != 0)
+  if ((((uintptr_t)buf | buf_size) & (SDS_CACHE_LINE_SIZE - 1U)) != 0U) {
+    // Buffer is not aligned to or not a multiple of the cache line size. Exit the function.
+    return NULL;
+  }
+#endif
 
   // Atomic allocation of a new control block for the SDS stream.
   stream = sdsAlloc(&index);
@@ -537,33 +1822,85 @@ sdsId_t sdsOpen (const char *name, sdsMode_t mode, void *buf, uint32_t buf_size)
     return NULL;
   }
 
+  // Create stream event flags.
+  stream->event = osEventFlagsNew(NULL);
+  if (stream->event == NULL) {
+    // Event flags creation failed. Free control block and exit the function.
+    SDS_PRINTF("SDS open failed to create stream event flags!\n");
+    sdsLockRelease(stream);
+    sdsFree(index);
+    return NULL;
+  }
+
   // Set control block parameters.
   stream->state           = SDS_STREAM_STATE_INACTIVE;
-  stream->index           = index & 0xFFU;
+  stream->index           = index & 0xFFFFU;
+  stream->mode            = (((uint32_t)mode & SDS_MODE_Msk) == sdsModeWrite) ? SDS_STREAM_MODE_WRITE : SDS_STREAM_MODE_READ;
   stream->flags           = 0U;
+  stream->priority        = SDS_PRIORITY_NORMAL;
+  stream->priority_set    = SDS_PRIORITY_NORMAL;
   stream->buf_size        = buf_size;
+  stream->latency         = 0U;
+  stream->flush           = 0U;
+  stream->seek            = 0U;
+  stream->multi           = 0U;
+  stream->chunk           = 0U;
+  stream->chunk_size      = 0U;
+  stream->recorder        = 0U;
+  stream->fr_state        = SDS_RECORDER_ARMED;
+  stream->fr_drop         = 0U;
+  stream->fr_last         = 0U;
   stream->head.timeslot   = 0U;
   stream->head.data_size  = 0U;
-
-  // Set threshold value for the stream.
-  if ((buf_size / 3) < SDS_IO_TRANSFER_SIZE) {
-    // Set threshold to 1/3 of the buffer size.
-    stream->threshold = buf_size / 3;
-  } else {
-    // Set threshold to SDSIO interface efficient transfer size.
-    stream->threshold = SDS_IO_TRANSFER_SIZE;
-  }
+  stream->rec_in          = 0U;
+  stream->rec_out         = 0U;
+  stream->rec_pos         = 0U;
+  stream->rec_held        = 0U;
+  stream->sdsio           = NULL;
+  memset(&stream->stats, 0, sizeof(sdsStats_t));
 
   // Open stream buffer.
   stream->sds_buffer = sdsBufferOpen(buf, buf_size, 0U, 0U);
 
-  if (mode == sdsModeWrite) {           // Write mode
-    stream->mode = SDS_STREAM_MODE_WRITE;
+  return stream;
+}
 
-    // Open sdsio stream (sds file).
-    stream->sdsio = sdsioOpen(name, sdsioModeWrite);
+// Get SDSIO open mode for SDS stream open mode (write mode with payload codec).
+static sdsioMode_t sdsOpenMode (sdsMode_t mode) {
 
-    // Check if sds stream (buffer) and sdsio stream (sds file) were opened successfully.
+  if (((uint32_t)mode & SDS_MODE_Msk) == sdsModeWrite) {
+    return (sdsioMode_t)(sdsioModeWrite | ((uint32_t)mode & SDSIO_CODEC_Msk));
+  }
+  return sdsioModeRead;
+}
+
+// Complete opening of a stream prepared by sdsOpenPrepare with the opened SDSIO stream.
+//  Return: pointer to stream control block or NULL on error (control block is freed).
+static sdsStream_t * sdsOpenComplete (sdsStream_t *stream, sdsioId_t sdsio, uint32_t async) {
+  uint32_t flags;
+  int32_t  err = SDS_OK;
+
+  stream->sdsio = sdsio;
+
+  // Get transfer size of SDSIO interface (for example negotiated by SDSIO-Client with SDSIO-Server).
+  //  It is read after the SDSIO stream is opened: capabilities received late apply to streams opened afterwards.
+  stream->transfer_size = sdsioGetTransferSize();
+  if (stream->transfer_size == 0U) {
+    stream->transfer_size = SDS_IO_TRANSFER_SIZE;
+  }
+  stream->quantum = stream->transfer_size;
+
+  // Set threshold value for the stream.
+  if ((stream->buf_size / 3) < stream->transfer_size) {
+    // Set threshold to 1/3 of the buffer size.
+    stream->threshold = stream->buf_size / 3;
+  } else {
+    // Set threshold to SDSIO interface efficient transfer size.
+    stream->threshold = stream->transfer_size;
+  }
+
+  if (stream->mode == SDS_STREAM_MODE_WRITE) {    // Write mode
+    // Check if sds stream (buffer) and sdsio stream (sds file) were opened successfully.
     if ((stream->sds_buffer != NULL) && (stream->sdsio != NULL)) {
       // Stream was successfully opened and control block is initialized.
       // Set state to write.
@@ -571,23 +1908,24 @@ sdsId_t sdsOpen (const char *name, sdsMode_t mode, void *buf, uint32_t buf_size)
     } else {
       err = SDS_ERROR;
     }
-  } else {                              // Read mode
-    stream->mode = SDS_STREAM_MODE_READ;
-
-    // Open sdsio stream (sds file).
-    stream->sdsio = sdsioOpen(name, sdsioModeRead);
-
+  } else {                                        // Read mode
     // Check if sds stream (buffer) and sdsio stream (sds file) were opened successfully.
-    if ((stream->sds_buffer != NULL) && (stream->sdsio != NULL)) {
+    if ((stream->sds_buffer != NULL) && (stream->sdsio != NULL) && (async != 0U)) {
+      // Streams were successfully opened. Set state to read: read functions return SDS_NO_DATA until data is available.
+      // Notify sdsThread to fill the SDS Stream Buffer; completion of the initial fill is signaled with SDS_EVENT_OPEN.
+      stream->flags = SDS_STREAM_ASYNC;
+      stream->state = SDS_STREAM_STATE_READ;
+      sdsSignal(stream);
+    } else if ((stream->sds_buffer != NULL) && (stream->sdsio != NULL)) {
       // Streams were successfully opened. Set state to opening.
       stream->state = SDS_STREAM_STATE_OPENING;
       // Read stream is in the opening state and the sdsThread should start
       // reading data from the SDSIO interface into the SDS Stream Buffer.
-      // Notify sdsThread to process this stream by setting the corresponding thread flag.
-      osThreadFlagsSet(sdsThreadId, 1U << index);
+      // Notify sdsThread to process this stream by adding it to the ready queue.
+      sdsSignal(stream);
 
       // Wait for notification from sdsThread that the stream buffer is filled with the data.
-      flags = osEventFlagsWait(sdsOpenEventFlags, 1U << index, osFlagsWaitAll, SDS_OPEN_TIMEOUT);
+      flags = osEventFlagsWait(stream->event, SDS_STREAM_EVENT_OPEN, osFlagsWaitAll, SDS_OPEN_TIMEOUT);
       if ((flags & osFlagsError) != 0U) {
         // Timeout or any other error occurred.
         err = SDS_ERROR;
@@ -603,39 +1941,1213 @@ sdsId_t sdsOpen (const char *name, sdsMode_t mode, void *buf, uint32_t buf_size)
     }
   }
 
-  if (err != SDS_OK) {
-    // Error occurred: Close streams, reset state.
-    if (stream->sds_buffer != NULL) {
-      sdsBufferClose(stream->sds_buffer);
-      stream->sds_buffer = NULL;
+  if (err != SDS_OK) {
+    // Error occurred: Close streams, reset state.
+    if (stream->sds_buffer != NULL) {
+      sdsBufferClose(stream->sds_buffer);
+      stream->sds_buffer = NULL;
+    }
+    if (stream->sdsio != NULL) {
+      sdsioClose(stream->sdsio);
+      stream->sdsio = NULL;
+    }
+    stream->state = SDS_STREAM_STATE_INACTIVE;
+  }
+
+  sdsLockRelease(stream);
+
+  if (err != SDS_OK) {
+    // Error occurred: delete stream event flags and free control block.
+    sdsEventDelete(stream);
+    sdsFree(stream->index);
+    stream = NULL;
+  }
+
+  return stream;
+}
+
+// Open SDS stream.
+//  async: 0 = wait until the SDS Stream Buffer of a read stream is filled,
+//         1 = read stream is filled by sdsThread after the function returns (completion: SDS_STREAM_EVENT_OPEN, SDS_EVENT_OPEN).
+static sdsStream_t * sdsOpenStream (const char *name, sdsMode_t mode, void *buf, uint32_t buf_size, uint32_t async) {
+  sdsStream_t *stream;
+
+  if (sdsInitialized == 0U) {
+    // The SDS system is not initialized. Exiting the function.
+    return NULL;
+  }
+
+  stream = sdsOpenPrepare(name, mode, buf, buf_size);
+  if (stream != NULL) {
+    // Open sdsio stream (sds file), write mode with payload codec.
+    stream = sdsOpenComplete(stream, sdsioOpen(name, sdsOpenMode(mode)), async);
+  }
+
+  return stream;
+}
+
+// SDS functions
+
+/**
+  Open SDS stream.
+*/
+sdsId_t sdsOpen (const char *name, sdsMode_t mode, void *buf, uint32_t buf_size) {
+  return sdsOpenStream(name, mode, buf, buf_size, 0U);
+}
+
+/**
+  Open SDS stream without waiting for the initial fill of a read stream.
+*/
+sdsId_t sdsOpenAsync (const char *name, sdsMode_t mode, void *buf, uint32_t buf_size) {
+  return sdsOpenStream(name, mode, buf, buf_size, 1U);
+}
+
+/**
+  Open a group of SDS streams.
+*/
+int32_t sdsOpenGroup (const sdsOpenParam_t *param, sdsId_t *id, uint32_t cnt) {
+  sdsioOpenParam_t io[SDS_OPEN_GROUP_SIZE];
+  sdsStream_t     *stream;
+  uint32_t         n, i, num, tick, elapsed, flags;
+  int32_t          ret = SDS_OK;
+
+  if (sdsInitialized == 0U) {
+    // The SDS system is not initialized. Exiting the function.
+    return SDS_ERROR;
+  }
+  if ((param == NULL) || (id == NULL) || (cnt == 0U)) {
+    // Invalid parameters. Exit the function.
+    return SDS_ERROR_PARAMETER;
+  }
+
+  for (n = 0U; n < cnt; n++) {
+    id[n] = NULL;
+  }
+
+  tick = osKernelGetTickCount();
+
+  // Open streams in batches of up to SDS_OPEN_GROUP_SIZE streams: the SDSIO streams of a batch are opened with
+  // one sdsioOpenGroup call (SDSIO-Client sends all open requests before it waits for the responses) and
+  // sdsThread fills the buffers of the read streams while the next batch is opened.
+  for (n = 0U; (n < cnt) && (ret == SDS_OK); n += num) {
+    for (num = 0U; ((n + num) < cnt) && (num < SDS_OPEN_GROUP_SIZE); num++) {
+      id[n + num] = sdsOpenPrepare(param[n + num].name, param[n + num].mode, param[n + num].buf, param[n + num].buf_size);
+      if (id[n + num] == NULL) {
+        ret = SDS_ERROR;
+        break;
+      }
+      io[num].name = param[n + num].name;
+      io[num].mode = sdsOpenMode(param[n + num].mode);
+      io[num].id   = NULL;
+    }
+    if ((ret == SDS_OK) && (num != 0U)) {
+      sdsioOpenGroup(io, num);
+    }
+    for (i = 0U; i < num; i++) {
+      // Complete opening of the prepared streams (control blocks of failed streams are freed).
+      id[n + i] = sdsOpenComplete(id[n + i], io[i].id, 1U);
+      if (id[n + i] == NULL) {
+        ret = SDS_ERROR;
+      }
+    }
+  }
+
+  // Wait until the buffers of all read streams are filled (one timeout for the whole group).
+  for (n = 0U; (ret == SDS_OK) && (n < cnt); n++) {
+    stream = id[n];
+    if (stream->mode != SDS_STREAM_MODE_READ) {
+      continue;
+    }
+    elapsed = osKernelGetTickCount() - tick;
+    flags   = osEventFlagsWait(stream->event, SDS_STREAM_EVENT_OPEN, osFlagsWaitAll | osFlagsNoClear,
+                               (elapsed < SDS_OPEN_TIMEOUT) ? (SDS_OPEN_TIMEOUT - elapsed) : 0U);
+    if ((flags & osFlagsError) != 0U) {
+      // Timeout or any other error occurred.
+      ret = SDS_ERROR;
+    }
+  }
+
+  if (ret != SDS_OK) {
+    // Error occurred: close streams which have been opened.
+    for (n = 0U; n < cnt; n++) {
+      if (id[n] != NULL) {
+        sdsClose(id[n]);
+        id[n] = NULL;
+      }
+    }
+  }
+
+  return ret;
+}
+
+/**
+  Close SDS stream.
+*/
+int32_t sdsClose (sdsId_t id) {
+  sdsStream_t *stream = id;
+  uint32_t     state;
+  int32_t      ret      = SDS_ERROR;
+  int32_t      err      = SDS_OK;
+  uint32_t     flags, tick;
+
+  if (sdsInitialized == 0U) {
+    // The SDS system is not initialized. Exiting the function.
+    return SDS_ERROR;
+  }
+  if (stream == NULL) {
+    // Invalid stream. Exit the function.
+    return SDS_ERROR_PARAMETER;
+  }
+  if (sdsLockAcquire(stream, SDS_CLOSE_TIMEOUT) == 0U) {
+    // Timeout occurred while waiting for lock.
+    return SDS_ERROR_TIMEOUT;
+  }
+  if (((stream->mode == SDS_STREAM_MODE_WRITE) && (stream->state != SDS_STREAM_STATE_WRITE)) ||
+      ((stream->mode == SDS_STREAM_MODE_READ ) && (stream->state != SDS_STREAM_STATE_READ))) {
+    // Stream is not in expected mode. Exit the function.
+    sdsLockRelease(stream);
+    return SDS_ERROR;
+  }
+
+  // Store current SDS Stream state
+  state = stream->state;
+
+  if ((state == SDS_STREAM_STATE_WRITE) && (stream->chunk != 0U)) {
+    // Record written in chunks is not completed: pad the rest of the data block with zeros.
+    sdsWritePad(stream, SDS_CLOSE_TIMEOUT);
+  }
+
+  // Set state to closing: read and write operations started after this point fail.
+  atomic_st32((uint32_t *)&stream->state, SDS_STREAM_STATE_CLOSING);
+
+  // Wake up threads waiting in sdsWriteTimeout or sdsReadTimeout.
+  osEventFlagsSet(stream->event, SDS_STREAM_EVENT_DATA);
+
+  // Wait until read and write operations in progress have left the stream.
+  tick = osKernelGetTickCount();
+  while (atomic_ld32((uint32_t *)&stream->busy) != 0U) {
+    if ((osKernelGetTickCount() - tick) >= SDS_CLOSE_TIMEOUT) {
+      // Timeout occurred.
+      err = SDS_ERROR_TIMEOUT;
+      break;
+    }
+    osDelay(1U);
+  }
+
+  if (err == SDS_OK) {
+    // Before SDS stream is closed, sdsThread should send all data in SDS Stream Buffer via SDSIO interface for write mode,
+    // for read mode sdsThread should stop reading data from SDSIO interface.
+    // Notify sdsThread to process this stream by adding it to the ready queue.
+    sdsSignal(stream);
+
+    // Wait for notification from sdsThread that thread has transferred all data from SDS Stream Buffer for write mode,
+    // for read mode wait for notification from sdsThread that thread has stopped reading data.
+    flags = osEventFlagsWait(stream->event, SDS_STREAM_EVENT_CLOSE, osFlagsWaitAll, SDS_CLOSE_TIMEOUT);
+    if ((flags & osFlagsError) != 0U) {
+      if (flags == osFlagsErrorTimeout) {
+        // Timeout occurred.
+        err = SDS_ERROR_TIMEOUT;
+      } else {
+        err = SDS_ERROR;
+      }
+    }
+  }
+
+  if (err == SDS_OK) {
+    // Close SDSIO stream.
+    err = sdsioClose(stream->sdsio);
+  }
+
+  if (err == SDS_OK) {
+    // Close SDS Buffer.
+    sdsBufferClose(stream->sds_buffer);
+
+    // Reset control block parameters.
+    stream->sds_buffer = NULL;
+    stream->sdsio      = NULL;
+
+    // Set state to inactive.
+    stream->state = SDS_STREAM_STATE_INACTIVE;
+
+    // Delete stream event flags and free control block.
+    sdsEventDelete(stream);
+    sdsFree(stream->index);
+
+    ret = SDS_OK;
+  } else {
+    // Close failed. Restore state back.
+    stream->state = state;
+    ret = err;
+  }
+  // Release lock.
+  sdsLockRelease(stream);
+
+  return ret;
+}
+
+/**
+  Write entire data block along with its timeslot information to the SDS stream opened in write mode.
+*/
+int32_t sdsWrite (sdsId_t id, uint32_t timeslot, const void *buf, uint32_t buf_size) {
+  return sdsWriteTimeout(id, timeslot, buf, buf_size, 0U);
+}
+
+/**
+  Write entire data block to the SDS stream opened in write mode, wait for space in the buffer with timeout.
+*/
+int32_t sdsWriteTimeout (sdsId_t id, uint32_t timeslot, const void *buf, uint32_t buf_size, uint32_t timeout) {
+  sdsStream_t *stream = id;
+  int32_t      ret;
+  uint32_t     flags, tick, elapsed;
+
+  if (sdsInitialized == 0U) {
+    // The SDS system is not initialized. Exiting the function.
+    return SDS_ERROR;
+  }
+  if (stream == NULL) {
+    // Invalid stream. Exit the function.
+    return SDS_ERROR_PARAMETER;
+  }
+
+  tick = osKernelGetTickCount();
+
+  while (1) {
+    if (timeout != 0U) {
+      // Clear data event before the available space is checked, so that a transfer done by sdsThread is not missed.
+      osEventFlagsClear(stream->event, SDS_STREAM_EVENT_DATA);
+    }
+
+    ret = sdsWriteBlock(stream, timeslot, buf, buf_size);
+    if ((ret != SDS_NO_SPACE) || (timeout == 0U)) {
+      break;
+    }
+
+    // Wait until sdsThread has transferred data from the SDS Stream Buffer.
+    if (timeout != osWaitForever) {
+      elapsed = osKernelGetTickCount() - tick;
+      if (elapsed >= timeout) {
+        // Timeout expired.
+        break;
+      }
+      flags = osEventFlagsWait(stream->event, SDS_STREAM_EVENT_DATA, osFlagsWaitAny | osFlagsNoClear, timeout - elapsed);
+    } else {
+      flags = osEventFlagsWait(stream->event, SDS_STREAM_EVENT_DATA, osFlagsWaitAny | osFlagsNoClear, osWaitForever);
+    }
+    if ((flags & osFlagsError) != 0U) {
+      // Timeout expired or error occurred.
+      break;
+    }
+  }
+
+  if (ret == SDS_NO_SPACE) {
+    // Update statistics.
+    sdsStatsAdd(stream, &stream->stats.no_space_cnt, 1U);
+    if (sdsEvent != NULL) {
+      // Notify the application about the error.
+      sdsEvent(stream, SDS_EVENT_NO_SPACE);
+    }
+  }
+
+  return ret;
+}
+
+/**
+  Write multiple data blocks along with their timeslot information to the SDS stream opened in write mode.
+*/
+int32_t sdsWriteBatch (sdsId_t id, const sdsRecord_t *rec, uint32_t rec_cnt) {
+  sdsStream_t    *stream = id;
+  int32_t         ret      = SDS_ERROR;
+  uint32_t        space, size, n;
+  uint32_t        written  = 0U;
+  dataBlockHead_t head;
+  sdsVec_t        vec;
+
+  if (sdsInitialized == 0U) {
+    // The SDS system is not initialized. Exiting the function.
+    return SDS_ERROR;
+  }
+  if (stream == NULL) {
+    // Invalid stream. Exit the function.
+    return SDS_ERROR_PARAMETER;
+  }
+
+  // Verify if parameters are valid.
+  if ((rec == NULL) || (rec_cnt == 0U)) {
+    return SDS_ERROR_PARAMETER;
+  }
+  for (n = 0U; n < rec_cnt; n++) {
+    if ((rec[n].buf == NULL) || (rec[n].buf_size == 0U)) {
+      return SDS_ERROR_PARAMETER;
+    }
+  }
+
+  if (sdsEnter(stream, SDS_STREAM_STATE_WRITE) == 0U) {
+    // Stream is not in writing state. Exit the function.
+    return SDS_ERROR;
+  }
+  if ((stream->head.data_size != 0U) || (stream->chunk != 0U)) {
+    // Data block is acquired or a record is written in chunks. Exit the function.
+    sdsLeave(stream);
+    return SDS_ERROR;
+  }
+
+  // Get free space in the SDS Stream Buffer once for all records.
+  space = stream->buf_size - sdsBufferGetCount(stream->sds_buffer);
+
+  // Write whole records (header + data block) in sequence while they fit into the buffer.
+  for (n = 0U; n < rec_cnt; n++) {
+    size = rec[n].buf_size + HEAD_SIZE;
+    if (stream->recorder != 0U) {
+      // Flight recorder: make space for the record.
+      sdsRecorderWrite(stream, rec[n].timeslot, size);
+      space = stream->buf_size - sdsBufferGetCount(stream->sds_buffer);
+    }
+    if (stream->multi != 0U) {
+      // Multi-producer mode: write record to space reserved atomically.
+      vec.buf      = rec[n].buf;
+      vec.buf_size = rec[n].buf_size;
+      if (sdsWriteMulti(stream, rec[n].timeslot, &vec, 1U, rec[n].buf_size) == 0U) {
+        break;
+      }
+      written += size;
+      continue;
+    }
+    if (size > space) {
+      break;
+    }
+    head.timeslot  = rec[n].timeslot;
+    head.data_size = rec[n].buf_size;
+    sdsBufferWrite(stream->sds_buffer, &head, HEAD_SIZE);
+    sdsBufferWrite(stream->sds_buffer, rec[n].buf, rec[n].buf_size);
+    space   -= size;
+    written += size;
+  }
+
+  if (n != 0U) {
+    // Return number of records written.
+    ret = (int32_t)n;
+    sdsStatsAdd(stream, &stream->stats.records, n);
+
+    // Notify the sdsThread by setting the corresponding thread flag to process the stream.
+    sdsWriteNotify(stream, written);
+  } else {
+    // Insufficient space in the stream buffer for the first record.
+    // Notify the sdsThread to transfer data from the SDS Stream Buffer (also below the threshold).
+    if (space != stream->buf_size) {
+      sdsFlushRequest(stream);
+    }
+    ret = SDS_NO_SPACE;
+  }
+
+  // Leave stream operation.
+  sdsLeave(stream);
+
+  if (ret == SDS_NO_SPACE) {
+    // Update statistics.
+    sdsStatsAdd(stream, &stream->stats.no_space_cnt, 1U);
+    if (sdsEvent != NULL) {
+      // Notify the application about the error.
+      sdsEvent(stream, SDS_EVENT_NO_SPACE);
+    }
+  }
+
+  return ret;
+}
+
+/**
+  Write data block composed of multiple buffers along with its timeslot information to the SDS stream opened in write mode.
+*/
+int32_t sdsWritev (sdsId_t id, uint32_t timeslot, const sdsVec_t *vec, uint32_t vec_cnt) {
+  sdsStream_t    *stream = id;
+  int32_t         ret      = SDS_ERROR;
+  uint32_t        size     = 0U;
+  uint32_t        written  = 0U;
+  uint32_t        n;
+  dataBlockHead_t head;
+
+  if (sdsInitialized == 0U) {
+    // The SDS system is not initialized. Exiting the function.
+    return SDS_ERROR;
+  }
+  if (stream == NULL) {
+    // Invalid stream. Exit the function.
+    return SDS_ERROR_PARAMETER;
+  }
+
+  // Verify if parameters are valid and get size of the data block.
+  if ((vec == NULL) || (vec_cnt == 0U)) {
+    return SDS_ERROR_PARAMETER;
+  }
+  for (n = 0U; n < vec_cnt; n++) {
+    if ((vec[n].buf == NULL) && (vec[n].buf_size != 0U)) {
+      return SDS_ERROR_PARAMETER;
+    }
+    size += vec[n].buf_size;
+  }
+  if (size == 0U) {
+    return SDS_ERROR_PARAMETER;
+  }
+
+  if (sdsEnter(stream, SDS_STREAM_STATE_WRITE) == 0U) {
+    // Stream is not in writing state. Exit the function.
+    return SDS_ERROR;
+  }
+  if ((stream->head.data_size != 0U) || (stream->chunk != 0U)) {
+    // Data block is acquired or a record is written in chunks. Exit the function.
+    sdsLeave(stream);
+    return SDS_ERROR;
+  }
+
+  if (stream->recorder != 0U) {
+    // Flight recorder: make space for the record.
+    sdsRecorderWrite(stream, timeslot, HEAD_SIZE + size);
+  }
+
+  if (stream->multi != 0U) {
+    // Multi-producer mode: write record to space reserved atomically.
+    written = sdsWriteMulti(stream, timeslot, vec, vec_cnt, size);
+  } else if ((size + HEAD_SIZE) <= (stream->buf_size - sdsBufferGetCount(stream->sds_buffer))) {
+    // Header + data fits into the buffer.
+    // Header: timeslot, data block size.
+    head.timeslot  = timeslot;
+    head.data_size = size;
+
+    // Write header and data block segments: Buffer size has been validated, so write operations are expected to succeed.
+    sdsBufferWrite(stream->sds_buffer, &head, HEAD_SIZE);
+    for (n = 0U; n < vec_cnt; n++) {
+      if (vec[n].buf_size != 0U) {
+        sdsBufferWrite(stream->sds_buffer, vec[n].buf, vec[n].buf_size);
+      }
+    }
+    written = 1U;
+  }
+
+  if (written != 0U) {
+    ret = (int32_t)size;
+    sdsStatsAdd(stream, &stream->stats.records, 1U);
+
+    // Notify the sdsThread by setting the corresponding thread flag to process the stream.
+    sdsWriteNotify(stream, HEAD_SIZE + size);
+  } else {
+    // Insufficient space in the stream buffer.
+    // Notify the sdsThread to transfer data from the SDS Stream Buffer (also below the threshold).
+    if (sdsBufferGetCount(stream->sds_buffer) != 0) {
+      sdsFlushRequest(stream);
+    }
+    ret = SDS_NO_SPACE;
+  }
+
+  // Leave stream operation.
+  sdsLeave(stream);
+
+  if (ret == SDS_NO_SPACE) {
+    // Update statistics.
+    sdsStatsAdd(stream, &stream->stats.no_space_cnt, 1U);
+    if (sdsEvent != NULL) {
+      // Notify the application about the error.
+      sdsEvent(stream, SDS_EVENT_NO_SPACE);
+    }
+  }
+
+  return ret;
+}
+
+/**
+  Acquire space for a data block directly in the SDS stream opened in write mode.
+*/
+int32_t sdsWriteAcquire (sdsId_t id, uint32_t timeslot, uint32_t buf_size, sdsBlock_t *block) {
+  sdsStream_t      *stream = id;
+  int32_t           ret      = SDS_ERROR;
+  sdsBufferRegion_t region;
+
+  if (sdsInitialized == 0U) {
+    // The SDS system is not initialized. Exiting the function.
+    return SDS_ERROR;
+  }
+  if (stream == NULL) {
+    // Invalid stream. Exit the function.
+    return SDS_ERROR_PARAMETER;
+  }
+  if (sdsEnter(stream, SDS_STREAM_STATE_WRITE) == 0U) {
+    // Stream is not in writing state. Exit the function.
+    return SDS_ERROR;
+  }
+  if ((stream->head.data_size != 0U) || (stream->chunk != 0U)) {
+    // Data block is already acquired or a record is written in chunks. Exit the function.
+    sdsLeave(stream);
+    return SDS_ERROR;
+  }
+  if (stream->multi != 0U) {
+    // Direct write is not supported in multi-producer mode. Exit the function.
+    sdsLeave(stream);
+    return SDS_ERROR;
+  }
+
+  // Verify if parameters are valid.
+  if ((block != NULL) && (buf_size != 0U)) {
+
+    if (stream->recorder != 0U) {
+      // Flight recorder: make space for the record.
+      sdsRecorderWrite(stream, timeslot, HEAD_SIZE + buf_size);
+    }
+
+    // Check if header + data fits into the buffer.
+    if ((buf_size + sizeof(dataBlockHead_t)) <= (stream->buf_size - sdsBufferGetCount(stream->sds_buffer))) {
+      // Store header of the acquired data block: header is written to the buffer on commit.
+      stream->head.timeslot  = timeslot;
+      stream->head.data_size = buf_size;
+
+      // Get data block region located after the header: Buffer size has been validated, so region covers whole data block.
+      sdsBufferWriteAcquire(stream->sds_buffer, HEAD_SIZE, buf_size, &region);
+      block->buf1  = region.buf1;
+      block->size1 = region.size1;
+      block->buf2  = region.buf2;
+      block->size2 = region.size2;
+
+      ret = (int32_t)buf_size;
+    } else {
+      // Insufficient space in the stream buffer.
+      // Notify the sdsThread to transfer data from the SDS Stream Buffer (also below the threshold).
+      if (sdsBufferGetCount(stream->sds_buffer) != 0) {
+        sdsFlushRequest(stream);
+      }
+      // Update statistics.
+      stream->stats.no_space_cnt++;
+      if (sdsEvent != NULL) {
+        // Notify the application about the error.
+        sdsEvent(stream, SDS_EVENT_NO_SPACE);
+      }
+      ret = SDS_NO_SPACE;
+    }
+  } else {
+    ret = SDS_ERROR_PARAMETER;
+  }
+
+  // Leave stream operation.
+  sdsLeave(stream);
+
+  return ret;
+}
+
+/**
+  Commit data block acquired with sdsWriteAcquire to the SDS stream opened in write mode.
+*/
+int32_t sdsWriteCommit (sdsId_t id, uint32_t buf_size) {
+  sdsStream_t      *stream = id;
+  int32_t           ret      = SDS_ERROR;
+  sdsBufferRegion_t region;
+
+  if (sdsInitialized == 0U) {
+    // The SDS system is not initialized. Exiting the function.
+    return SDS_ERROR;
+  }
+  if (stream == NULL) {
+    // Invalid stream. Exit the function.
+    return SDS_ERROR_PARAMETER;
+  }
+  if (sdsEnter(stream, SDS_STREAM_STATE_WRITE) == 0U) {
+    // Stream is not in writing state. Exit the function.
+    return SDS_ERROR;
+  }
+  if (stream->head.data_size == 0U) {
+    // No data block is acquired. Exit the function.
+    sdsLeave(stream);
+    return SDS_ERROR;
+  }
+
+  // Verify if parameters are valid.
+  if (buf_size <= stream->head.data_size) {
+    if (buf_size != 0U) {
+      // Update data block size and write header in front of the data block.
+      stream->head.data_size = buf_size;
+      sdsBufferWriteAcquire(stream->sds_buffer, 0U, HEAD_SIZE, &region);
+      sdsRegionWrite(&region, &stream->head);
+
+      // Commit header and data block: Buffer size has been validated on acquire, so commit is expected to succeed.
+      sdsBufferWriteCommit(stream->sds_buffer, HEAD_SIZE + buf_size);
+      stream->stats.records++;
+
+      // Notify the sdsThread by setting the corresponding thread flag to process the stream.
+      sdsWriteNotify(stream, HEAD_SIZE + buf_size);
+    }
+
+    // Data block is committed or discarded (buf_size = 0).
+    stream->head.data_size = 0U;
+
+    ret = (int32_t)buf_size;
+  } else {
+    ret = SDS_ERROR_PARAMETER;
+  }
+
+  // Leave stream operation.
+  sdsLeave(stream);
+
+  return ret;
+}
+
+/**
+  Begin writing a record in chunks to the SDS stream opened in write mode.
+*/
+int32_t sdsWriteBegin (sdsId_t id, uint32_t timeslot, uint32_t total_size) {
+  sdsStream_t    *stream = id;
+  int32_t         ret    = SDS_ERROR;
+  dataBlockHead_t head;
+
+  if (sdsInitialized == 0U) {
+    // The SDS system is not initialized. Exiting the function.
+    return SDS_ERROR;
+  }
+  if ((stream == NULL) || (total_size == 0U)) {
+    // Invalid parameters. Exit the function.
+    return SDS_ERROR_PARAMETER;
+  }
+  if (sdsEnter(stream, SDS_STREAM_STATE_WRITE) == 0U) {
+    // Stream is not in writing state. Exit the function.
+    return SDS_ERROR;
+  }
+  if ((stream->head.data_size != 0U) || (stream->chunk != 0U) || (stream->multi != 0U) || (stream->recorder != 0U)) {
+    // Data block is acquired, a record is already written in chunks or
+    // the stream is in multi-producer or flight recorder mode. Exit the function.
+    sdsLeave(stream);
+    return SDS_ERROR;
+  }
+
+  // Check if header fits into the buffer.
+  if (HEAD_SIZE <= (stream->buf_size - sdsBufferGetCount(stream->sds_buffer))) {
+    // Header: timeslot, size of the whole data block (stream format is the same as for a record written at once).
+    head.timeslot  = timeslot;
+    head.data_size = total_size;
+    sdsBufferWrite(stream->sds_buffer, &head, HEAD_SIZE);
+
+    stream->chunk_size = total_size;
+    stream->chunk      = 1U;
+
+    // Notify the sdsThread by setting the corresponding thread flag to process the stream.
+    sdsWriteNotify(stream, HEAD_SIZE);
+
+    ret = SDS_OK;
+  } else {
+    // Insufficient space in the stream buffer.
+    // Notify the sdsThread to transfer data from the SDS Stream Buffer (also below the threshold).
+    sdsFlushRequest(stream);
+    ret = SDS_NO_SPACE;
+  }
+
+  // Leave stream operation.
+  sdsLeave(stream);
+
+  if (ret == SDS_NO_SPACE) {
+    // Update statistics.
+    stream->stats.no_space_cnt++;
+    if (sdsEvent != NULL) {
+      // Notify the application about the error.
+      sdsEvent(stream, SDS_EVENT_NO_SPACE);
+    }
+  }
+
+  return ret;
+}
+
+/**
+  Write data chunk of the record started with sdsWriteBegin, wait for space in the buffer with timeout.
+*/
+int32_t sdsWriteChunk (sdsId_t id, const void *buf, uint32_t buf_size, uint32_t timeout) {
+  sdsStream_t *stream = id;
+  int32_t      ret;
+  uint32_t     num = 0U;
+  uint32_t     tick;
+
+  if (sdsInitialized == 0U) {
+    // The SDS system is not initialized. Exiting the function.
+    return SDS_ERROR;
+  }
+  if ((stream == NULL) || (buf == NULL) || (buf_size == 0U)) {
+    // Invalid parameters. Exit the function.
+    return SDS_ERROR_PARAMETER;
+  }
+
+  tick = osKernelGetTickCount();
+
+  while (1) {
+    if (timeout != 0U) {
+      // Clear data event before the available space is checked, so that a transfer done by sdsThread is not missed.
+      osEventFlagsClear(stream->event, SDS_STREAM_EVENT_DATA);
+    }
+
+    ret = sdsWriteChunkBlock(stream, (const uint8_t *)buf + num, buf_size - num);
+    if (ret < 0) {
+      break;
+    }
+    num += (uint32_t)ret;
+    if (num == buf_size) {
+      break;
+    }
+
+    // Wait until sdsThread has transferred data from the SDS Stream Buffer.
+    if (sdsWaitData(stream, tick, timeout) == 0U) {
+      break;
+    }
+  }
+
+  if (num != 0U) {
+    ret = (int32_t)num;
+  } else if (ret == 0) {
+    ret = SDS_NO_SPACE;
+
+    // Update statistics.
+    stream->stats.no_space_cnt++;
+    if (sdsEvent != NULL) {
+      // Notify the application about the error.
+      sdsEvent(stream, SDS_EVENT_NO_SPACE);
+    }
+  }
+
+  return ret;
+}
+
+/**
+  End writing the record started with sdsWriteBegin.
+*/
+int32_t sdsWriteEnd (sdsId_t id) {
+  sdsStream_t *stream = id;
+  int32_t      ret;
+  uint32_t     incomplete;
+
+  if (sdsInitialized == 0U) {
+    // The SDS system is not initialized. Exiting the function.
+    return SDS_ERROR;
+  }
+  if (stream == NULL) {
+    // Invalid stream. Exit the function.
+    return SDS_ERROR_PARAMETER;
+  }
+  if (stream->chunk == 0U) {
+    // No record is written in chunks. Exit the function.
+    return SDS_ERROR;
+  }
+
+  // Record is complete when all data announced with sdsWriteBegin is written,
+  // otherwise the rest of the data block is padded with zeros.
+  incomplete = stream->chunk_size;
+  ret = sdsWritePad(stream, SDS_CLOSE_TIMEOUT);
+  if ((ret == SDS_OK) && (incomplete != 0U)) {
+    // Record is completed with padding.
+    ret = SDS_ERROR;
+  }
+
+  return ret;
+}
+
+/**
+  Read entire data block along with its timeslot information from the SDS stream opened in read mode.
+*/
+int32_t sdsRead (sdsId_t id, uint32_t *timeslot, void *buf, uint32_t buf_size) {
+  return sdsReadTimeout(id, timeslot, buf, buf_size, 0U);
+}
+
+/**
+  Read entire data block from the SDS stream opened in read mode, wait for data in the buffer with timeout.
+*/
+int32_t sdsReadTimeout (sdsId_t id, uint32_t *timeslot, void *buf, uint32_t buf_size, uint32_t timeout) {
+  sdsStream_t *stream = id;
+  int32_t      ret;
+  uint32_t     flags, tick, elapsed;
+
+  if (sdsInitialized == 0U) {
+    // The SDS system is not initialized. Exiting the function.
+    return SDS_ERROR;
+  }
+  if (stream == NULL) {
+    // Invalid stream. Exit the function.
+    return SDS_ERROR_PARAMETER;
+  }
+
+  tick = osKernelGetTickCount();
+
+  while (1) {
+    if (timeout != 0U) {
+      // Clear data event before the available data is checked, so that a transfer done by sdsThread is not missed.
+      osEventFlagsClear(stream->event, SDS_STREAM_EVENT_DATA);
+    }
+
+    ret = sdsReadBlock(stream, timeslot, buf, buf_size);
+    if ((ret != SDS_NO_DATA) || (timeout == 0U)) {
+      break;
+    }
+
+    // Wait until sdsThread has transferred data to the SDS Stream Buffer.
+    if (timeout != osWaitForever) {
+      elapsed = osKernelGetTickCount() - tick;
+      if (elapsed >= timeout) {
+        // Timeout expired.
+        break;
+      }
+      flags = osEventFlagsWait(stream->event, SDS_STREAM_EVENT_DATA, osFlagsWaitAny | osFlagsNoClear, timeout - elapsed);
+    } else {
+      flags = osEventFlagsWait(stream->event, SDS_STREAM_EVENT_DATA, osFlagsWaitAny | osFlagsNoClear, osWaitForever);
+    }
+    if ((flags & osFlagsError) != 0U) {
+      // Timeout expired or error occurred.
+      break;
+    }
+  }
+
+  if (ret == SDS_NO_DATA) {
+    // Update statistics.
+    stream->stats.no_data_cnt++;
+    if (sdsEvent != NULL) {
+      // Notify the application about the error.
+      sdsEvent(stream, SDS_EVENT_NO_DATA);
+    }
+  }
+
+  return ret;
+}
+
+/**
+  Begin reading a record in chunks from the SDS stream opened in read mode.
+*/
+int32_t sdsReadBegin (sdsId_t id, uint32_t *timeslot) {
+  sdsStream_t      *stream = id;
+  sdsBufferRegion_t region;
+  dataBlockHead_t   head;
+  int32_t           ret;
+  uint32_t          eos;
+
+  if (sdsInitialized == 0U) {
+    // The SDS system is not initialized. Exiting the function.
+    return SDS_ERROR;
+  }
+  if (stream == NULL) {
+    // Invalid stream. Exit the function.
+    return SDS_ERROR_PARAMETER;
+  }
+  if (sdsEnter(stream, SDS_STREAM_STATE_READ) == 0U) {
+    // Stream is not in read state. Exit the function.
+    return SDS_ERROR;
+  }
+  if (stream->chunk != 0U) {
+    // Record is already read in chunks. Exit the function.
+    sdsLeave(stream);
+    return SDS_ERROR;
+  }
+
+  // Release the record retained by sdsReadAligned.
+  sdsIndexRelease(stream);
+
+  // Save eos flag.
+  eos = stream->flags & SDS_STREAM_EOS;
+
+  if (sdsIndexUpdate(stream) != 0U) {
+    // Data block is completely available: take the header from the record index.
+    head.timeslot  = stream->rec_index[stream->rec_out % SDS_RECORD_INDEX_SIZE].timeslot;
+    head.data_size = stream->rec_index[stream->rec_out % SDS_RECORD_INDEX_SIZE].size;
+    stream->rec_out++;
+    ret = SDS_OK;
+  } else if ((stream->chunk_size == 0U) && (sdsBufferGetCount(stream->sds_buffer) >= (int32_t)HEAD_SIZE)) {
+    // Only the header is available (record index is empty, so the header is at the start of the buffer).
+    // The data block is read while sdsThread fills the buffer; indexing resumes after the record.
+    sdsBufferReadAcquire(stream->sds_buffer, 0U, HEAD_SIZE, &region);
+    sdsRegionRead(&region, &head);
+    stream->rec_pos += HEAD_SIZE + head.data_size;
+    ret = SDS_OK;
+  } else if (sdsIndexEos(stream, eos) != 0U) {
+    ret = SDS_EOS;
+  } else {
+    // Header is not available in the SDS Stream Buffer.
+    ret = SDS_NO_DATA;
+  }
+
+  if (ret == SDS_OK) {
+    // Release the header: data block is read with sdsReadChunk.
+    sdsBufferReadCommit(stream->sds_buffer, HEAD_SIZE);
+    stream->chunk_size = head.data_size;
+    stream->chunk      = 1U;
+
+    if (timeslot != NULL) {
+      *timeslot = head.timeslot;
+    }
+    ret = (int32_t)head.data_size;
+  }
+
+  // Leave stream operation.
+  sdsLeave(stream);
+
+  return ret;
+}
+
+/**
+  Read data chunk of the record started with sdsReadBegin, wait for data in the buffer with timeout.
+*/
+int32_t sdsReadChunk (sdsId_t id, void *buf, uint32_t buf_size, uint32_t timeout) {
+  sdsStream_t *stream = id;
+  int32_t      ret;
+  uint32_t     num = 0U;
+  uint32_t     tick;
+
+  if (sdsInitialized == 0U) {
+    // The SDS system is not initialized. Exiting the function.
+    return SDS_ERROR;
+  }
+  if ((stream == NULL) || (buf == NULL) || (buf_size == 0U)) {
+    // Invalid parameters. Exit the function.
+    return SDS_ERROR_PARAMETER;
+  }
+
+  tick = osKernelGetTickCount();
+
+  while (1) {
+    if (timeout != 0U) {
+      // Clear data event before the available data is checked, so that a transfer done by sdsThread is not missed.
+      osEventFlagsClear(stream->event, SDS_STREAM_EVENT_DATA);
+    }
+
+    ret = sdsReadChunkBlock(stream, (uint8_t *)buf + num, buf_size - num);
+    if (ret < 0) {
+      break;
+    }
+    num += (uint32_t)ret;
+    if ((num == buf_size) || (stream->chunk_size == 0U)) {
+      // Buffer is full or whole data block is read.
+      break;
+    }
+
+    // Wait until sdsThread has transferred data to the SDS Stream Buffer.
+    if (sdsWaitData(stream, tick, timeout) == 0U) {
+      break;
+    }
+  }
+
+  if (num != 0U) {
+    ret = (int32_t)num;
+  } else if ((ret == 0) && (stream->chunk_size != 0U)) {
+    ret = SDS_NO_DATA;
+
+    // Update statistics.
+    stream->stats.no_data_cnt++;
+    if (sdsEvent != NULL) {
+      // Notify the application about the error.
+      sdsEvent(stream, SDS_EVENT_NO_DATA);
+    }
+  }
+
+  return ret;
+}
+
+/**
+  End reading the record started with sdsReadBegin.
+*/
+int32_t sdsReadEnd (sdsId_t id) {
+  sdsStream_t *stream = id;
+  int32_t      ret    = SDS_ERROR;
+
+  if (sdsInitialized == 0U) {
+    // The SDS system is not initialized. Exiting the function.
+    return SDS_ERROR;
+  }
+  if (stream == NULL) {
+    // Invalid stream. Exit the function.
+    return SDS_ERROR_PARAMETER;
+  }
+  if (sdsEnter(stream, SDS_STREAM_STATE_READ) == 0U) {
+    // Stream is not in read state. Exit the function.
+    return SDS_ERROR;
+  }
+
+  if (stream->chunk != 0U) {
+    stream->chunk = 0U;
+    if (stream->chunk_size == 0U) {
+      // Record is complete when the whole data block is read.
+      stream->stats.records++;
+      ret = SDS_OK;
+    } else {
+      // Data block is not read completely: discard the rest of the data block.
+      sdsChunkDiscard(stream);
+    }
+  }
+
+  // Leave stream operation.
+  sdsLeave(stream);
+
+  return ret;
+}
+
+/**
+  Get data block size from an SDS stream opened in read mode.
+*/
+int32_t sdsGetSize (sdsId_t id) {
+  sdsStream_t *stream = id;
+  int32_t      ret;
+  uint32_t     eos;
+
+  if (sdsInitialized == 0U) {
+    // The SDS system is not initialized. Exiting the function.
+    return SDS_ERROR;
+  }
+  if (stream == NULL) {
+    // Invalid stream. Exit the function.
+    return SDS_ERROR_PARAMETER;
+  }
+  if (sdsEnter(stream, SDS_STREAM_STATE_READ) == 0U) {
+    // Stream is not in read state. Exit the function.
+    return SDS_ERROR;
+  }
+  if (stream->chunk != 0U) {
+    // Record is read in chunks. Exit the function.
+    sdsLeave(stream);
+    return SDS_ERROR;
+  }
+
+  // Release the record retained by sdsReadAligned.
+  sdsIndexRelease(stream);
+
+  // Save eos flag.
+  eos = stream->flags & SDS_STREAM_EOS;
+
+  if (sdsIndexUpdate(stream) != 0U) {
+    // Return size of the data block.
+    ret = (int32_t)stream->rec_index[stream->rec_out % SDS_RECORD_INDEX_SIZE].size;
+  } else if (sdsIndexEos(stream, eos) != 0U) {
+    ret = SDS_EOS;
+  } else {
+    // Whole header or data block is not available in the SDS Stream Buffer.
+    ret = SDS_NO_DATA;
+  }
+
+  // Leave stream operation.
+  sdsLeave(stream);
+  return ret;
+}
+
+/**
+  Get timeslot of the next data block from an SDS stream opened in read mode.
+*/
+int32_t sdsPeekTimeslot (sdsId_t id, uint32_t *timeslot) {
+  sdsStream_t *stream = id;
+  int32_t      ret;
+  uint32_t     eos;
+
+  if (sdsInitialized == 0U) {
+    // The SDS system is not initialized. Exiting the function.
+    return SDS_ERROR;
+  }
+  if ((stream == NULL) || (timeslot == NULL)) {
+    // Invalid parameters. Exit the function.
+    return SDS_ERROR_PARAMETER;
+  }
+  if (sdsEnter(stream, SDS_STREAM_STATE_READ) == 0U) {
+    // Stream is not in read state. Exit the function.
+    return SDS_ERROR;
+  }
+  if (stream->chunk != 0U) {
+    // Record is read in chunks. Exit the function.
+    sdsLeave(stream);
+    return SDS_ERROR;
+  }
+
+  // Release the record retained by sdsReadAligned.
+  sdsIndexRelease(stream);
+
+  // Save eos flag.
+  eos = stream->flags & SDS_STREAM_EOS;
+
+  if (sdsIndexUpdate(stream) != 0U) {
+    // Return timeslot of the data block.
+    *timeslot = stream->rec_index[stream->rec_out % SDS_RECORD_INDEX_SIZE].timeslot;
+    ret = SDS_OK;
+  } else if (sdsIndexEos(stream, eos) != 0U) {
+    ret = SDS_EOS;
+  } else {
+    // Whole header or data block is not available in the SDS Stream Buffer.
+    ret = SDS_NO_DATA;
+  }
+
+  // Leave stream operation.
+  sdsLeave(stream);
+  return ret;
+}
+
+/**
+  Skip data blocks of an SDS stream opened in read mode.
+*/
+int32_t sdsSkip (sdsId_t id, uint32_t n) {
+  sdsStream_t *stream = id;
+  int32_t      ret;
+  uint32_t     eos, num, cnt, size;
+
+  if (sdsInitialized == 0U) {
+    // The SDS system is not initialized. Exiting the function.
+    return SDS_ERROR;
+  }
+  if (stream == NULL) {
+    // Invalid stream. Exit the function.
+    return SDS_ERROR_PARAMETER;
+  }
+  if (sdsEnter(stream, SDS_STREAM_STATE_READ) == 0U) {
+    // Stream is not in read state. Exit the function.
+    return SDS_ERROR;
+  }
+  if (stream->chunk != 0U) {
+    // Record is read in chunks. Exit the function.
+    sdsLeave(stream);
+    return SDS_ERROR;
+  }
+
+  // Release the record retained by sdsReadAligned.
+  sdsIndexRelease(stream);
+
+  // Save eos flag.
+  eos = stream->flags & SDS_STREAM_EOS;
+
+  // Remove records from the record index without copying the data blocks.
+  num  = 0U;
+  size = 0U;
+  while (num < n) {
+    cnt = sdsIndexUpdate(stream);
+    if (cnt == 0U) {
+      // No more complete data blocks available.
+      break;
     }
-    if (stream->sdsio != NULL) {
-      sdsioClose(stream->sdsio);
-      stream->sdsio = NULL;
+    if (cnt > (n - num)) {
+      cnt = n - num;
+    }
+    num += cnt;
+    while (cnt != 0U) {
+      size += HEAD_SIZE + stream->rec_index[stream->rec_out % SDS_RECORD_INDEX_SIZE].size;
+      stream->rec_out++;
+      cnt--;
     }
-    stream->state = SDS_STREAM_STATE_INACTIVE;
   }
 
-  sdsLockRelease(stream);
+  if (size != 0U) {
+    // Release skipped records in the SDS Stream Buffer.
+    sdsBufferReadCommit(stream->sds_buffer, size);
 
-  if (err != SDS_OK) {
-    // Error occurred: free control block.
-    sdsFree(index);
-    stream = NULL;
+    // If free space in the SDS Stream Buffer is at or above the threshold,
+    // notify the sdsThread by setting the corresponding thread flag to process the stream.
+    if ((stream->buf_size - sdsBufferGetCount(stream->sds_buffer)) >= stream->threshold) {
+      sdsSignal(stream);
+    }
   }
 
-  return stream;
+  if ((num == 0U) && (n != 0U) && (sdsIndexEos(stream, eos) != 0U)) {
+    ret = SDS_EOS;
+  } else {
+    ret = (int32_t)num;
+  }
+
+  // Leave stream operation.
+  sdsLeave(stream);
+  return ret;
 }
 
 /**
-  Close SDS stream.
+  Reposition SDS stream opened in read mode to a timeslot.
 */
-int32_t sdsClose (sdsId_t id) {
+int32_t sdsSeek (sdsId_t id, uint32_t timeslot) {
   sdsStream_t *stream = id;
-  uint32_t     state;
-  int32_t      ret      = SDS_ERROR;
-  int32_t      err      = SDS_OK;
-  uint32_t     event_mask, flags;
+  uint32_t     flags, tick, elapsed, cnt_in, cnt_out;
+  int32_t      ret;
 
   if (sdsInitialized == 0U) {
     // The SDS system is not initialized. Exiting the function.
@@ -645,78 +3157,124 @@ int32_t sdsClose (sdsId_t id) {
     // Invalid stream. Exit the function.
     return SDS_ERROR_PARAMETER;
   }
-  if (sdsLockAcquire(stream, SDS_CLOSE_TIMEOUT) == 0U) {
+  if (sdsLockAcquire(stream, SDS_OPEN_TIMEOUT) == 0U) {
     // Timeout occurred while waiting for lock.
     return SDS_ERROR_TIMEOUT;
   }
-  if (((stream->mode == SDS_STREAM_MODE_WRITE) && (stream->state != SDS_STREAM_STATE_WRITE)) ||
-      ((stream->mode == SDS_STREAM_MODE_READ ) && (stream->state != SDS_STREAM_STATE_READ))) {
-    // Stream is not in expected mode. Exit the function.
+  if ((stream->mode != SDS_STREAM_MODE_READ) || (stream->state != SDS_STREAM_STATE_READ) || (stream->chunk != 0U)) {
+    // Stream is not in read state or a record is read in chunks. Exit the function.
     sdsLockRelease(stream);
     return SDS_ERROR;
   }
 
-  // Store current SDS Stream state
-  state = stream->state;
-
-  // Set state to closing.
-  stream->state = SDS_STREAM_STATE_CLOSING;
+  tick = osKernelGetTickCount();
 
-  // Before SDS stream is closed, sdsThread should send all data in SDS Stream Buffer via SDSIO interface for write mode,
-  // for read mode sdsThread should stop reading data from SDSIO interface.
-  // Notify sdsThread to process this stream by setting the corresponding thread flag.
-  event_mask = 1U << stream->index;
-  osThreadFlagsSet(sdsThreadId, event_mask);
+  // Request sdsThread to reposition the SDSIO stream.
+  osEventFlagsClear(stream->event, SDS_STREAM_EVENT_SEEK | SDS_STREAM_EVENT_OPEN);
+  stream->seek_timeslot = timeslot;
+  atomic_st32((uint32_t *)&stream->seek, 1U);
+  sdsSignal(stream);
 
-  // Wait for notification from sdsThread that thread has transferred all data from SDS Stream Buffer for write mode,
-  // for read mode wait for notification from sdsThread that thread has stopped reading data.
-  flags = osEventFlagsWait(sdsCloseEventFlags, event_mask, osFlagsWaitAll, SDS_CLOSE_TIMEOUT);
+  // Wait for notification from sdsThread that the seek request is processed.
+  flags = osEventFlagsWait(stream->event, SDS_STREAM_EVENT_SEEK, osFlagsWaitAll, SDS_OPEN_TIMEOUT);
   if ((flags & osFlagsError) != 0U) {
-    if (flags == osFlagsErrorTimeout) {
-      // Timeout occurred.
-      err = SDS_ERROR_TIMEOUT;
-    } else {
-      err = SDS_ERROR;
+    ret = SDS_ERROR_TIMEOUT;
+  } else {
+    ret = stream->seek_status;
+  }
+
+  if (ret == SDS_OK) {
+    // SDS Stream Buffer has been cleared by sdsThread: restart the record index at the current stream position.
+    sdsBufferGetCounters(stream->sds_buffer, &cnt_in, &cnt_out);
+    stream->rec_in   = 0U;
+    stream->rec_out  = 0U;
+    stream->rec_pos    = cnt_out;
+    stream->rec_held   = 0U;
+    stream->chunk_size = 0U;
+
+    // Wait until the SDS Stream Buffer is filled from the new position (at least to threshold or EOS).
+    elapsed = osKernelGetTickCount() - tick;
+    flags   = osEventFlagsWait(stream->event, SDS_STREAM_EVENT_OPEN, osFlagsWaitAll | osFlagsNoClear,
+                               (elapsed < SDS_OPEN_TIMEOUT) ? (SDS_OPEN_TIMEOUT - elapsed) : 0U);
+    if ((flags & osFlagsError) != 0U) {
+      ret = SDS_ERROR_TIMEOUT;
     }
   }
 
-  if (err == SDS_OK) {
-    // Close SDSIO stream.
-    err = sdsioClose(stream->sdsio);
+  sdsLockRelease(stream);
+
+  return ret;
+}
+
+/**
+  Read timeslot-aligned data blocks from a group of SDS streams opened in read mode.
+*/
+int32_t sdsReadAligned (const sdsId_t *id, sdsAlignedRecord_t *rec, uint32_t cnt, uint32_t timeslot, uint32_t timeout) {
+  sdsStream_t *stream;
+  int32_t      ret;
+  uint32_t     n, tick;
+  uint32_t     num = 0U;
+
+  if (sdsInitialized == 0U) {
+    // The SDS system is not initialized. Exiting the function.
+    return SDS_ERROR;
+  }
+  if ((id == NULL) || (rec == NULL) || (cnt == 0U)) {
+    // Invalid parameters. Exit the function.
+    return SDS_ERROR_PARAMETER;
+  }
+  for (n = 0U; n < cnt; n++) {
+    if ((id[n] == NULL) || (rec[n].buf == NULL) || (rec[n].buf_size == 0U)) {
+      return SDS_ERROR_PARAMETER;
+    }
   }
 
-  if (err == SDS_OK) {
-    // Close SDS Buffer.
-    sdsBufferClose(stream->sds_buffer);
+  tick = osKernelGetTickCount();
 
-    // Reset control block parameters.
-    stream->sds_buffer = NULL;
-    stream->sdsio      = NULL;
+  // All streams are needed for the timeslot: wait for each stream in turn (one timeout for the whole group).
+  for (n = 0U; n < cnt; n++) {
+    stream = id[n];
+    while (1) {
+      if (timeout != 0U) {
+        // Clear data event before the available data is checked, so that a transfer done by sdsThread is not missed.
+        osEventFlagsClear(stream->event, SDS_STREAM_EVENT_DATA);
+      }
 
-    // Set state to inactive.
-    stream->state = SDS_STREAM_STATE_INACTIVE;
+      ret = sdsReadAlignedBlock(stream, timeslot, &rec[n]);
+      if (ret != SDS_NO_DATA) {
+        break;
+      }
 
-    sdsFree(stream->index);
+      // Wait until sdsThread has transferred data to the SDS Stream Buffer.
+      if (sdsWaitData(stream, tick, timeout) == 0U) {
+        break;
+      }
+    }
+    rec[n].status = ret;
 
-    ret = SDS_OK;
-  } else {
-    // Close failed. Restore state back.
-    stream->state = state;
-    ret = err;
+    if (ret > 0) {
+      num++;
+    } else if (ret == SDS_NO_DATA) {
+      // Update statistics.
+      stream->stats.no_data_cnt++;
+      if (sdsEvent != NULL) {
+        // Notify the application about the error.
+        sdsEvent(stream, SDS_EVENT_NO_DATA);
+      }
+    }
   }
-  // Release lock.
-  sdsLockRelease(stream);
 
-  return ret;
+  return (int32_t)num;
 }
 
 /**
-  Write entire data block along with its timeslot information to the SDS stream opened in write mode.
+  Flush data of the SDS stream opened in write mode.
 */
-int32_t sdsWrite (sdsId_t id, uint32_t timeslot, const void *buf, uint32_t buf_size) {
-  sdsStream_t    *stream = id;
-  int32_t         ret      = SDS_ERROR;
-  dataBlockHead_t head;
+int32_t sdsFlush (sdsId_t id) {
+  sdsStream_t *stream = id;
+  int32_t      ret;
+  uint32_t     cnt_in, cnt_out, fr_state;
+  uint32_t     flags, tick, elapsed;
 
   if (sdsInitialized == 0U) {
     // The SDS system is not initialized. Exiting the function.
@@ -726,60 +3284,82 @@ int32_t sdsWrite (sdsId_t id, uint32_t timeslot, const void *buf, uint32_t buf_s
     // Invalid stream. Exit the function.
     return SDS_ERROR_PARAMETER;
   }
-  if (sdsLockAcquire(stream, 0) == 0U) {
-    // Failed to acquire lock.
-    return SDS_ERROR;
-  }
-  if (stream->state != SDS_STREAM_STATE_WRITE) {
+  if (sdsEnter(stream, SDS_STREAM_STATE_WRITE) == 0U) {
     // Stream is not in writing state. Exit the function.
-    sdsLockRelease(stream);
     return SDS_ERROR;
   }
 
-  // Verify if parameters are valid.
-  if ((buf != NULL) && (buf_size != 0U)) {
+  if ((stream->recorder != 0U) && (atomic_ld32((uint32_t *)&stream->fr_state) <= SDS_RECORDER_TRIGGER)) {
+    // Flight recorder is armed: no data is pending for transfer.
+    sdsLeave(stream);
+    return SDS_OK;
+  }
 
-    // Check if header + data fits into the buffer.
-    if ((buf_size + sizeof(dataBlockHead_t)) <= (stream->buf_size - sdsBufferGetCount(stream->sds_buffer))) {
-      // Header: timeslot, data block size.
-      head.timeslot  = timeslot;
-      head.data_size = buf_size;
+  // Data written up to now (total bytes written to the SDS Stream Buffer) is flushed.
+  sdsBufferGetCounters(stream->sds_buffer, &cnt_in, &cnt_out);
+  if (cnt_out != cnt_in) {
+    // Request sdsThread to transfer all data from the SDS Stream Buffer.
+    sdsFlushRequest(stream);
+  }
 
-      // Write header and data block: Buffer size has been validated, so write operations are expected to succeed.
-      sdsBufferWrite(stream->sds_buffer, &head, sizeof(dataBlockHead_t));
-      ret = sdsBufferWrite(stream->sds_buffer, buf, buf_size);
+  // Leave stream operation.
+  sdsLeave(stream);
 
-      // If amount of data in the SDS Stream Buffer is at or above the threshold,
-      // notify the sdsThread by setting the corresponding thread flag to process the stream.
-      if (sdsBufferGetCount(stream->sds_buffer) >= (int32_t)stream->threshold) {
-        osThreadFlagsSet(sdsThreadId, 1U << stream->index);
-      }
-    } else {
-      // Insufficient space in the stream buffer.
-      if (sdsEvent != NULL) {
-        // Notify the application about the error.
-        sdsEvent(stream, SDS_EVENT_NO_SPACE);
+  tick = osKernelGetTickCount();
+
+  while (1) {
+    // Clear data event before the transferred data is checked, so that a transfer done by sdsThread is not missed.
+    osEventFlagsClear(stream->event, SDS_STREAM_EVENT_DATA);
+
+    if (sdsEnter(stream, SDS_STREAM_STATE_WRITE) == 0U) {
+      // Stream is closing. Exit the function.
+      ret = SDS_ERROR;
+      break;
+    }
+    sdsBufferGetCounters(stream->sds_buffer, NULL, &cnt_out);
+    fr_state = atomic_ld32((uint32_t *)&stream->fr_state);
+    sdsLeave(stream);
+
+    if ((int32_t)(cnt_out - cnt_in) >= 0) {
+      // All data has been transferred to the SDSIO interface.
+      ret = SDS_OK;
+      break;
+    }
+    if ((stream->recorder != 0U) && (fr_state == SDS_RECORDER_ARMED)) {
+      // Flight recorder: captured window has been transferred, data after the window is not transferred.
+      ret = SDS_OK;
+      break;
+    }
+
+    // Wait until sdsThread has transferred data from the SDS Stream Buffer.
+    elapsed = osKernelGetTickCount() - tick;
+    if (elapsed >= SDS_FLUSH_TIMEOUT) {
+      // Timeout expired.
+      ret = SDS_ERROR_TIMEOUT;
+      break;
+    }
+    flags = osEventFlagsWait(stream->event, SDS_STREAM_EVENT_DATA, osFlagsWaitAny | osFlagsNoClear, SDS_FLUSH_TIMEOUT - elapsed);
+    if ((flags & osFlagsError) != 0U) {
+      if (flags == osFlagsErrorTimeout) {
+        // Timeout occurred.
+        ret = SDS_ERROR_TIMEOUT;
+      } else {
+        ret = SDS_ERROR;
       }
-      ret = SDS_NO_SPACE;
+      break;
     }
-  } else {
-    ret = SDS_ERROR_PARAMETER;
   }
 
-  // Release lock.
-  sdsLockRelease(stream);
-
   return ret;
 }
 
 /**
-  Read entire data block along with its timeslot information from the SDS stream opened in read mode.
+  Trigger the flight recorder of the SDS stream opened in write mode.
 */
-int32_t sdsRead (sdsId_t id, uint32_t *timeslot, void *buf, uint32_t buf_size) {
+int32_t sdsTrigger (sdsId_t id, uint32_t pre, uint32_t post) {
   sdsStream_t *stream = id;
   int32_t      ret      = SDS_ERROR;
-  int32_t      eos      = 0;
-  int32_t      size;
+  uint32_t     timeslot;
 
   if (sdsInitialized == 0U) {
     // The SDS system is not initialized. Exiting the function.
@@ -789,95 +3369,107 @@ int32_t sdsRead (sdsId_t id, uint32_t *timeslot, void *buf, uint32_t buf_size) {
     // Invalid stream. Exit the function.
     return SDS_ERROR_PARAMETER;
   }
-  if (sdsLockAcquire(stream, 0) == 0U) {
-    // Failed to acquire lock.
+  if (sdsEnter(stream, SDS_STREAM_STATE_WRITE) == 0U) {
+    // Stream is not in writing state. Exit the function.
     return SDS_ERROR;
   }
-  if (stream->state != SDS_STREAM_STATE_READ) {
-    // Stream is not in read state. Exit the function.
-    sdsLockRelease(stream);
+
+  // Flight recorder must be armed: a trigger during the capture of a window is rejected.
+  if ((stream->recorder != 0U) && (atomic_wr32_if_zero((uint32_t *)&stream->fr_state, SDS_RECORDER_TRIGGER) != 0U)) {
+    // Captured window is relative to the timeslot of the last record written.
+    timeslot = atomic_ld32((uint32_t *)&stream->fr_last);
+    stream->fr_begin = timeslot - pre;
+    stream->fr_end   = timeslot + post;
+
+    // Start the capture: notify sdsThread to transfer the captured window.
+    atomic_st32((uint32_t *)&stream->fr_state, SDS_RECORDER_CAPTURE);
+    sdsSignal(stream);
+
+    ret = SDS_OK;
+  }
+
+  // Leave stream operation.
+  sdsLeave(stream);
+
+  return ret;
+}
+
+/**
+  Get runtime statistics of SDS stream.
+*/
+int32_t sdsGetStats (sdsId_t id, sdsStats_t *stats) {
+  sdsStream_t *stream = id;
+  uint32_t     state;
+
+  if (sdsInitialized == 0U) {
+    // The SDS system is not initialized. Exiting the function.
     return SDS_ERROR;
   }
+  if ((stream == NULL) || (stats == NULL)) {
+    // Invalid parameters. Exit the function.
+    return SDS_ERROR_PARAMETER;
+  }
 
-  // Verify if parameters are valid.
-  if ((buf != NULL) && (buf_size != 0U)) {
-    // Save eos flag.
-    eos = stream->flags & SDS_STREAM_EOS;
-    // Get size of available data block.
-    size = sdsBufferGetCount(stream->sds_buffer);
+  state = (stream->mode == SDS_STREAM_MODE_WRITE) ? SDS_STREAM_STATE_WRITE : SDS_STREAM_STATE_READ;
+  if (sdsEnter(stream, state) == 0U) {
+    // Stream is not open. Exit the function.
+    return SDS_ERROR;
+  }
 
-    // Check if header was already read:
-    // If not (head.data_size == 0) and there is enough data available, read new header.
-    if ((stream->head.data_size == 0U) && (size >= (int32_t)HEAD_SIZE)) {
-      sdsBufferRead(stream->sds_buffer, &stream->head, HEAD_SIZE);
-      size -= HEAD_SIZE;
-    }
+  // Copy statistics collected by SDS and add SDS Stream Buffer statistics.
+  memcpy(stats, &stream->stats, sizeof(sdsStats_t));
+  sdsBufferGetCounters(stream->sds_buffer, &stats->bytes_in, &stats->bytes_out);
+  stats->buf_size = stream->buf_size;
+  stats->buf_max  = (uint32_t)sdsBufferGetMaxCount(stream->sds_buffer);
 
-    // Check if Header is valid and data block size in header is valid.
-    if (stream->head.data_size != 0U) {
-      // Check if whole data block fits into the provided buffer.
-      if (stream->head.data_size > buf_size) {
-        // Provided buffer is too small to read the data block.
-        ret = SDS_ERROR_PARAMETER;
-      } else {
-        // Check if whole data block is available in the SDS Stream Buffer.
-        if ((int32_t)stream->head.data_size > size) {
-          // Whole data block is not available in the SDS Stream Buffer.
-          ret = SDS_NO_DATA;
-        } else {
-          // Read data block from SDS Stream Buffer:
-          // Buffer size has been validated, so read operation is expected to succeed.
-          ret = sdsBufferRead(stream->sds_buffer, buf, stream->head.data_size);
-
-          // Get timeslot from the header.
-          if (timeslot != NULL) {
-            *timeslot = stream->head.timeslot;
-          }
-
-          // Whole data block has been read from the SDS Stream Buffer.
-          // Clear the header information to enable reading of the next data block.
-          stream->head.data_size = 0U;
-
-          // If free space in the SDS Stream Buffer is at or above the threshold,
-          // notify the sdsThread by setting the corresponding thread flag to process the stream.
-          if ((stream->buf_size - sdsBufferGetCount(stream->sds_buffer)) >= stream->threshold) {
-            osThreadFlagsSet(sdsThreadId, 1U << stream->index);
-          }
-        }
-      }
-    } else {
-      // Header is not valid.
-      // Check for End Of Stream.
-      if ((size == 0) && (eos != 0U)) {
-        ret = SDS_EOS;
-      } else {
-        // Whole header is not available in the SDS Stream Buffer.
-        ret = SDS_NO_DATA;
-      }
-    }
-  } else {
-    ret = SDS_ERROR_PARAMETER;
+  // Leave stream operation.
+  sdsLeave(stream);
+
+  return SDS_OK;
+}
+
+/**
+  Get runtime statistics of SDS stream by stream index.
+*/
+int32_t sdsGetStatsByIndex (uint32_t index, void **sdsio_id, sdsStats_t *stats) {
+  sdsStream_t *stream;
+  int32_t      ret;
+
+  if ((index >= SDS_MAX_STREAMS) || (sdsio_id == NULL) || (stats == NULL)) {
+    // Invalid parameters. Exit the function.
+    return SDS_ERROR_PARAMETER;
+  }
+  if (sdsInitialized == 0U) {
+    // The SDS system is not initialized. Exiting the function.
+    return SDS_ERROR;
   }
 
-  if ((ret == SDS_NO_DATA) && (sdsEvent != NULL)) {
-    // Notify the application about the error.
-    sdsEvent(stream, SDS_EVENT_NO_DATA);
+  stream = psdsStreams[index];
+  if (stream == NULL) {
+    // Stream control block is not allocated.
+    return SDS_ERROR;
   }
 
-  // Release Lock.
-  sdsLockRelease(stream);
+  ret = sdsGetStats(stream, stats);
+  if (ret == SDS_OK) {
+    *sdsio_id = stream->sdsio;
+    if (*sdsio_id == NULL) {
+      // Stream has been closed in the meantime.
+      ret = SDS_ERROR;
+    }
+  }
 
   return ret;
 }
 
 /**
-  Get data block size from an SDS stream opened in read mode.
+  Control SDS stream.
 */
-int32_t sdsGetSize (sdsId_t id) {
+int32_t sdsControl (sdsId_t id, uint32_t control, uint32_t arg) {
   sdsStream_t *stream = id;
-  int32_t      ret      = SDS_ERROR;
-  int32_t      eos      = 0;
-  int32_t      size;
+  int32_t      ret      = SDS_OK;
+  uint32_t     state;
+  uint32_t     cnt_in;
 
   if (sdsInitialized == 0U) {
     // The SDS system is not initialized. Exiting the function.
@@ -887,50 +3479,81 @@ int32_t sdsGetSize (sdsId_t id) {
     // Invalid stream. Exit the function.
     return SDS_ERROR_PARAMETER;
   }
-  if (sdsLockAcquire(stream, 0) == 0U) {
-    // Failed to acquire lock.
-    return SDS_ERROR;
-  }
-  if (stream->state != SDS_STREAM_STATE_READ) {
-    // Stream is not in read state. Exit the function.
-    sdsLockRelease(stream);
+
+  state = (stream->mode == SDS_STREAM_MODE_WRITE) ? SDS_STREAM_STATE_WRITE : SDS_STREAM_STATE_READ;
+  if (sdsEnter(stream, state) == 0U) {
+    // Stream is not open. Exit the function.
     return SDS_ERROR;
   }
 
-  // Save eos flag.
-  eos = stream->flags & SDS_STREAM_EOS;
-  // Get size of available data block.
-  size = sdsBufferGetCount(stream->sds_buffer);
+  switch (control) {
+    case SDS_CONTROL_PRIORITY:
+      // Set stream priority class (used by sdsThread for selecting the next stream to process).
+      //  The stream may be in a ready queue: the new priority is applied when it is added to a ready queue again.
+      if (arg <= SDS_PRIORITY_HIGH) {
+        stream->priority_set = (uint8_t)arg;
+      } else {
+        ret = SDS_ERROR_PARAMETER;
+      }
+      break;
 
-  // Check if header was already read:
-  // If not (head.data_size == 0) and there is enough data available, read new header.
-  if ((stream->head.data_size == 0U) && (size >= (int32_t)HEAD_SIZE)) {
-    sdsBufferRead(stream->sds_buffer, &stream->head, HEAD_SIZE);
-    size -= HEAD_SIZE;
-  }
+    case SDS_CONTROL_QUANTUM:
+      // Set maximum number of bytes transferred in one scheduling step (0 = default).
+      if (arg != 0U) {
+        stream->quantum = arg;
+      } else {
+        stream->quantum = stream->transfer_size;
+      }
+      break;
 
-  // Check if Header is valid and data block size in header is valid.
-  if (stream->head.data_size != 0U) {
-    if ((int32_t)stream->head.data_size > size) {
-      // Whole data block is not available in the SDS Stream Buffer.
-      ret = SDS_NO_DATA;
-    } else {
-      // Return size of the data block.
-      ret = stream->head.data_size;
-    }
-  } else {
-    // Header is not valid.
-    // Check for End Of Stream.
-    if ((size == 0) && (eos != 0U)) {
-      ret = SDS_EOS;
-    } else {
-      // Whole header is not available in the SDS Stream Buffer.
-      ret = SDS_NO_DATA;
-    }
+    case SDS_CONTROL_LATENCY:
+      // Set maximum latency of data in the stream buffer in ticks (0 = disabled, write mode only).
+      if ((stream->mode == SDS_STREAM_MODE_WRITE) && (arg < 0x80000000U)) {
+        stream->latency = arg;
+        // Notify sdsThread to (re)evaluate the latency timer for data already in the buffer.
+        sdsSignal(stream);
+      } else {
+        ret = SDS_ERROR_PARAMETER;
+      }
+      break;
+
+    case SDS_CONTROL_RECORDER:
+      // Enable or disable flight recorder mode (write mode only, before data is written to the stream).
+      if ((stream->mode == SDS_STREAM_MODE_WRITE) && (arg <= 1U)) {
+        sdsBufferGetCounters(stream->sds_buffer, &cnt_in, NULL);
+        if ((cnt_in == 0U) && (stream->head.data_size == 0U) && (stream->multi == 0U)) {
+          stream->recorder = arg;
+        } else {
+          ret = SDS_ERROR;
+        }
+      } else {
+        ret = SDS_ERROR_PARAMETER;
+      }
+      break;
+
+    case SDS_CONTROL_MULTI_PRODUCER:
+      // Enable or disable multi-producer mode (write mode only, before data is written to the stream).
+      if ((stream->mode == SDS_STREAM_MODE_WRITE) && (arg <= 1U)) {
+        sdsBufferGetCounters(stream->sds_buffer, &cnt_in, NULL);
+        if ((cnt_in == 0U) && (stream->head.data_size == 0U) && (stream->recorder == 0U) &&
+            ((stream->buf_size & (stream->buf_size - 1U)) == 0U)) {
+          stream->multi = arg;
+        } else {
+          ret = SDS_ERROR;
+        }
+      } else {
+        ret = SDS_ERROR_PARAMETER;
+      }
+      break;
+
+    default:
+      ret = SDS_ERROR_PARAMETER;
+      break;
   }
 
-  // Release Lock.
-  sdsLockRelease(stream);
+  // Leave stream operation.
+  sdsLeave(stream);
+
   return ret;
 }
 
@@ -28,8 +28,30 @@
 #include "sds.h"
 #include "sds_buffer.h"
 
+// Cache line size in bytes (producer and consumer indices are placed in separate cache lines)
+#ifndef SDS_BUFFER_CACHE_LINE_SIZE
+#define SDS_BUFFER_CACHE_LINE_SIZE      32U
+#endif
+
+// Power-of-two buffer sizes (0 = any buffer size, 1 = buffer size must be a power of two)
+#ifndef SDS_BUFFER_POW2
+#define SDS_BUFFER_POW2                 0
+#endif
+
 // Control block
+//  The buffer is a single-producer/single-consumer queue: write functions (sdsBufferWrite, sdsBufferWriteAcquire,
+//  sdsBufferWriteCommit) are called by the producer, read functions (sdsBufferRead, sdsBufferReadAcquire,
+//  sdsBufferReadCommit, sdsBufferClear) by the consumer. Producer and consumer may run on different cores.
+//  Each side publishes its counter with release semantics after the buffer data is written or read and
+//  loads the counter of the other side with acquire semantics.
+//  With SDS_BUFFER_POW2 enabled the buffer indices are derived from the monotonic counters with a mask
+//  (cnt & (buf_size - 1)) instead of being maintained separately with wrap-around compares.
+//  Multi-producer mode (sdsBufferReserve, sdsBufferReserveCommit) replaces the producer functions: writers
+//  reserve space by advancing cnt_rsv atomically and count themselves in nest while they write the data.
+//  The last writer leaving publishes cnt_in = cnt_rsv, so data becomes visible in reservation order and
+//  only when all data reserved before it is written.
 typedef struct {
+  // Stream parameters (set in sdsBufferOpen and sdsBufferRegisterEvents, read-only afterwards)
            sdsBufferEvent_t  event_cb;          // Optional event callback
            uint32_t          event_mask;        // Bitmask of enabled events (e.g., SDS_BUFFER_EVENT_DATA_HIGH/LOW)
            void             *event_arg;         // User context pointer passed back to event_cb
@@ -37,10 +59,21 @@ typedef struct {
            uint32_t          buf_size;          // Size of the buffer in bytes
            uint32_t          threshold_high;    // High threshold value (triggers DATA_HIGH event)
            uint32_t          threshold_low;     // Low threshold value (triggers DATA_LOW event)
-  volatile uint32_t          cnt_in;            // Monotonic total bytes written ((cnt_in - cnt_out) = current fill level)
-  volatile uint32_t          cnt_out;           // Monotonic total bytes read/cleared ((cnt_in - cnt_out) = current fill level)
-  volatile uint32_t          idx_in;            // Write index in the buffer (wraps at buf_size)
-  volatile uint32_t          idx_out;           // Read index in the buffer (wraps at buf_size)
+  // Producer
+           uint32_t          cnt_in __ALIGNED(SDS_BUFFER_CACHE_LINE_SIZE);
+                                                // Monotonic total bytes written ((cnt_in - cnt_out) = current fill level)
+#if (SDS_BUFFER_POW2 == 0)
+           uint32_t          idx_in;            // Write index in the buffer (wraps at buf_size)
+#endif
+           uint32_t          cnt_max;           // Maximum fill level (high-water mark, updated on write)
+           uint32_t          cnt_rsv;           // Monotonic total bytes reserved (multi-producer mode)
+           uint32_t          nest;              // Number of reservations in progress (multi-producer mode)
+  // Consumer
+           uint32_t          cnt_out __ALIGNED(SDS_BUFFER_CACHE_LINE_SIZE);
+                                                // Monotonic total bytes read/cleared ((cnt_in - cnt_out) = current fill level)
+#if (SDS_BUFFER_POW2 == 0)
+           uint32_t          idx_out;           // Read index in the buffer (wraps at buf_size)
+#endif
 } sdsBuffer_t;
 
 // Allocate memory for the SDS Buffer streams depending on configured maximum number of streams.
@@ -49,15 +82,112 @@ static sdsBuffer_t *pSDSBufferStreams[SDS_MAX_STREAMS] = {NULL};
 
 // Helper functions
 
-// Atomic Operation: Write 32-bit value to memory, if existing value in memory is zero.
+#if defined(__STDC_NO_ATOMICS__)
+// Atomic Operation: Load 32-bit value from memory (acquire).
+__STATIC_INLINE uint32_t atomic_ld32_acquire (uint32_t *mem) {
+  uint32_t val;
+
+  val = *(volatile uint32_t *)mem;
+  __DMB();
+
+  return val;
+}
+
+// Atomic Operation: Store 32-bit value to memory (release).
+__STATIC_INLINE void atomic_st32_release (uint32_t *mem, uint32_t val) {
+
+  __DMB();
+  *(volatile uint32_t *)mem = val;
+}
+
+// Atomic Operation: Load 32-bit value from memory (sequentially consistent).
+__STATIC_INLINE uint32_t atomic_ld32 (uint32_t *mem) {
+  uint32_t val;
+
+  __DMB();
+  val = *(volatile uint32_t *)mem;
+  __DMB();
+
+  return val;
+}
+
+// Atomic Operation: Add signed value to 32-bit value in memory.
+//  Return: new value.
+__STATIC_INLINE uint32_t atomic_add32 (uint32_t *mem, int32_t val) {
+  uint32_t primask = __get_PRIMASK();
+  uint32_t ret;
+
+  __disable_irq();
+  ret  = *mem + (uint32_t)val;
+  *mem = ret;
+  if (primask == 0U) {
+    __enable_irq();
+  }
+
+  return ret;
+}
+
+// Atomic Operation: Write 32-bit value to memory if existing value in memory is equal to expected value.
+//  Return: 1 when new value is written or 0 otherwise (expected is updated with the value in memory).
+__STATIC_INLINE uint32_t atomic_cas32 (uint32_t *mem, uint32_t *expected, uint32_t val) {
+  uint32_t primask = __get_PRIMASK();
+  uint32_t ret = 0U;
+
+  __disable_irq();
+  if (*mem == *expected) {
+    *mem = val;
+    ret = 1U;
+  } else {
+    *expected = *mem;
+  }
+  if (primask == 0U) {
+    __enable_irq();
+  }
+
+  return ret;
+}
+#else
+// Atomic Operation: Load 32-bit value from memory (acquire).
+__STATIC_INLINE uint32_t atomic_ld32_acquire (uint32_t *mem) {
+  return atomic_load_explicit((_Atomic uint32_t *)mem, memory_order_acquire);
+}
+
+// Atomic Operation: Store 32-bit value to memory (release).
+__STATIC_INLINE void atomic_st32_release (uint32_t *mem, uint32_t val) {
+  atomic_store_explicit((_Atomic uint32_t *)mem, val, memory_order_release);
+}
+
+// Atomic Operation: Load 32-bit value from memory (sequentially consistent).
+__STATIC_INLINE uint32_t atomic_ld32 (uint32_t *mem) {
+  return atomic_load_explicit((_Atomic uint32_t *)mem, memory_order_seq_cst);
+}
+
+// Atomic Operation: Add signed value to 32-bit value in memory.
+//  Return: new value.
+__STATIC_INLINE uint32_t atomic_add32 (uint32_t *mem, int32_t val) {
+  return (atomic_fetch_add_explicit((_Atomic uint32_t *)mem, (uint32_t)val, memory_order_seq_cst) + (uint32_t)val);
+}
+
+// Atomic Operation: Write 32-bit value to memory if existing value in memory is equal to expected value.
+//  Return: 1 when new value is written or 0 otherwise (expected is updated with the value in memory).
+__STATIC_INLINE uint32_t atomic_cas32 (uint32_t *mem, uint32_t *expected, uint32_t val) {
+  return (atomic_compare_exchange_weak_explicit((_Atomic uint32_t *)mem,
+                                                expected,
+                                                val,
+                                                memory_order_seq_cst,
+                                                memory_order_seq_cst) ? 1U : 0U);
+}
+#endif
+
+// Atomic Operation: Write pointer value to memory, if existing value in memory is NULL.
 //  Return: 1 when new value is written or 0 otherwise.
-#if defined(__STDC_NO_ATOMICS__) || !defined(ATOMIC_CHAR32_T_LOCK_FREE) || (ATOMIC_CHAR32_T_LOCK_FREE < 2)
-__STATIC_INLINE uint32_t atomic_wr32_if_zero (uint32_t *mem, uint32_t val) {
+#if defined(__STDC_NO_ATOMICS__) || !defined(ATOMIC_POINTER_LOCK_FREE) || (ATOMIC_POINTER_LOCK_FREE < 2)
+__STATIC_INLINE uint32_t atomic_wrptr_if_null (void **mem, void *val) {
   uint32_t primask = __get_PRIMASK();
   uint32_t ret = 0U;
 
   __disable_irq();
-  if (*mem == 0U) {
+  if (*mem == NULL) {
     *mem = val;
     ret = 1U;
   }
@@ -68,21 +198,17 @@ __STATIC_INLINE uint32_t atomic_wr32_if_zero (uint32_t *mem, uint32_t val) {
   return ret;
 }
 #else
-__STATIC_INLINE uint32_t atomic_wr32_if_zero (uint32_t *mem, uint32_t val) {
-  uint32_t expected;
-  uint32_t ret = 1U;
-
-  expected = *mem;
-  do {
-    if (expected != 0U) {
-      ret = 0U;
-      break;
-    }
-  } while (!atomic_compare_exchange_weak_explicit((_Atomic uint32_t *)mem,
-                                                  &expected,
-                                                  val,
-                                                  memory_order_acq_rel,
-                                                  memory_order_relaxed));
+__STATIC_INLINE uint32_t atomic_wrptr_if_null (void **mem, void *val) {
+  void    *expected = NULL;
+  uint32_t ret      = 0U;
+
+  if (atomic_compare_exchange_strong_explicit((void * _Atomic *)mem,
+                                              &expected,
+                                              val,
+                                              memory_order_acq_rel,
+                                              memory_order_relaxed)) {
+    ret = 1U;
+  }
 
   return ret;
 }
@@ -93,7 +219,7 @@ static sdsBuffer_t *sdsBufferAlloc (void) {
   uint32_t     n;
 
   for (n = 0U; n < SDS_MAX_STREAMS; n++) {
-    if (atomic_wr32_if_zero((uint32_t *)&pSDSBufferStreams[n], (uint32_t)&SDSBufferStreams[n]) != 0U) {
+    if (atomic_wrptr_if_null((void **)&pSDSBufferStreams[n], &SDSBufferStreams[n]) != 0U) {
       sds_buffer = &SDSBufferStreams[n];
       break;
     }
@@ -101,6 +227,124 @@ static sdsBuffer_t *sdsBufferAlloc (void) {
   return sds_buffer;
 }
 
+// Add num bytes to buffer index idx (num <= buf_size).
+__STATIC_INLINE uint32_t sdsBufferIdxAdd (const sdsBuffer_t *sds_buffer, uint32_t idx, uint32_t num) {
+#if (SDS_BUFFER_POW2 != 0)
+  return ((idx + num) & (sds_buffer->buf_size - 1U));
+#else
+  idx += num;
+  if (idx >= sds_buffer->buf_size) {
+    idx -= sds_buffer->buf_size;
+  }
+  return idx;
+#endif
+}
+
+// Get write index (producer).
+__STATIC_INLINE uint32_t sdsBufferIdxIn (const sdsBuffer_t *sds_buffer, uint32_t cnt_in) {
+#if (SDS_BUFFER_POW2 != 0)
+  return (cnt_in & (sds_buffer->buf_size - 1U));
+#else
+  (void)cnt_in;
+  return sds_buffer->idx_in;
+#endif
+}
+
+// Get read index (consumer).
+__STATIC_INLINE uint32_t sdsBufferIdxOut (const sdsBuffer_t *sds_buffer, uint32_t cnt_out) {
+#if (SDS_BUFFER_POW2 != 0)
+  return (cnt_out & (sds_buffer->buf_size - 1U));
+#else
+  (void)cnt_out;
+  return sds_buffer->idx_out;
+#endif
+}
+
+// Advance write index idx by num bytes (producer).
+__STATIC_INLINE void sdsBufferAdvanceIn (sdsBuffer_t *sds_buffer, uint32_t idx, uint32_t num) {
+#if (SDS_BUFFER_POW2 != 0)
+  // Write index is derived from cnt_in.
+  (void)sds_buffer;
+  (void)idx;
+  (void)num;
+#else
+  sds_buffer->idx_in = sdsBufferIdxAdd(sds_buffer, idx, num);
+#endif
+}
+
+// Advance read index idx by num bytes (consumer).
+__STATIC_INLINE void sdsBufferAdvanceOut (sdsBuffer_t *sds_buffer, uint32_t idx, uint32_t num) {
+#if (SDS_BUFFER_POW2 != 0)
+  // Read index is derived from cnt_out.
+  (void)sds_buffer;
+  (void)idx;
+  (void)num;
+#else
+  sds_buffer->idx_out = sdsBufferIdxAdd(sds_buffer, idx, num);
+#endif
+}
+
+// Get buffer region of num bytes starting at buffer index idx.
+static void sdsBufferGetRegion (sdsBuffer_t *sds_buffer, uint32_t idx, uint32_t num, sdsBufferRegion_t *region) {
+  uint32_t cnt_limit;
+
+  cnt_limit = sds_buffer->buf_size - idx;
+
+  region->buf1 = sds_buffer->buf + idx;
+  if (num > cnt_limit) {
+    // buffer rollover
+    region->size1 = cnt_limit;
+    region->buf2  = sds_buffer->buf;
+    region->size2 = num - cnt_limit;
+  } else {
+    region->size1 = num;
+    region->buf2  = NULL;
+    region->size2 = 0U;
+  }
+}
+
+// Leave reservation (multi-producer mode).
+//  The last writer leaving publishes all reserved data to the consumer. A writer which reserves space
+//  after cnt_rsv is loaded is still counted in nest, so data is never published before it is written.
+static void sdsBufferLeave (sdsBuffer_t *sds_buffer) {
+  uint32_t cnt_rsv, cnt_in, cnt_out, cnt_max;
+
+  while (1) {
+    cnt_rsv = atomic_ld32(&sds_buffer->cnt_rsv);
+    if (atomic_add32(&sds_buffer->nest, -1) != 0U) {
+      // Other reservations are in progress: the last writer leaving publishes the data.
+      break;
+    }
+
+    // All reserved data up to cnt_rsv is written: publish it (cnt_in never moves backwards).
+    cnt_in = atomic_ld32(&sds_buffer->cnt_in);
+    while ((int32_t)(cnt_rsv - cnt_in) > 0) {
+      if (atomic_cas32(&sds_buffer->cnt_in, &cnt_in, cnt_rsv) != 0U) {
+        // Update high-water mark.
+        cnt_out = atomic_ld32_acquire(&sds_buffer->cnt_out);
+        cnt_max = atomic_ld32(&sds_buffer->cnt_max);
+        while (((cnt_rsv - cnt_out) > cnt_max) && (atomic_cas32(&sds_buffer->cnt_max, &cnt_max, cnt_rsv - cnt_out) == 0U)) {
+          // High-water mark updated by another writer: compare again.
+        }
+
+        if ((sds_buffer->event_cb != NULL) && ((sds_buffer->event_mask & SDS_BUFFER_EVENT_DATA_HIGH) != 0U)) {
+          if (((cnt_in - cnt_out) < sds_buffer->threshold_high) && ((cnt_rsv - cnt_out) >= sds_buffer->threshold_high)) {
+            sds_buffer->event_cb(sds_buffer, SDS_BUFFER_EVENT_DATA_HIGH, sds_buffer->event_arg);
+          }
+        }
+        break;
+      }
+    }
+
+    if (atomic_ld32(&sds_buffer->cnt_rsv) == cnt_rsv) {
+      break;
+    }
+    // Space has been reserved in the meantime and the writer may have left before the data was published:
+    // enter again and publish its data unless another writer is still in progress.
+    atomic_add32(&sds_buffer->nest, 1);
+  }
+}
+
 static void sdsBufferFree (sdsBuffer_t *sds_buffer) {
   uint32_t n;
 
@@ -121,7 +365,11 @@ sdsBufferId_t sdsBufferOpen (void *buf, uint32_t buf_size, uint32_t threshold_lo
   sdsBuffer_t *sds_buffer = NULL;
 
   // Buffer pointer needs to be valid
+#if (SDS_BUFFER_POW2 != 0)
+  if ((buf != NULL) && (buf_size != 0U) && ((buf_size & (buf_size - 1U)) == 0U)) {
+#else
   if ((buf != NULL) && (buf_size != 0U)) {
+#endif
     sds_buffer = sdsBufferAlloc();
     if (sds_buffer != NULL) {
       memset(sds_buffer, 0, sizeof(sdsBuffer_t));
@@ -170,12 +418,13 @@ int32_t sdsBufferRegisterEvents (sdsBufferId_t id, sdsBufferEvent_t event_cb, ui
 int32_t sdsBufferWrite (sdsBufferId_t id, const void *buf, uint32_t buf_size) {
   sdsBuffer_t   *sds_buffer = id;
   uint32_t       num = 0U;
-  uint32_t       cnt_free, cnt_used, cnt_used_new, cnt_limit;
+  uint32_t       cnt_in, cnt_free, cnt_used, cnt_used_new, cnt_limit, idx;
   int32_t        ret = SDS_ERROR_PARAMETER;
 
   if ((sds_buffer != NULL) && (buf != NULL) && (buf_size != 0U)) {
 
-    cnt_used = sds_buffer->cnt_in - sds_buffer->cnt_out;
+    cnt_in   = sds_buffer->cnt_in;
+    cnt_used = cnt_in - atomic_ld32_acquire(&sds_buffer->cnt_out);
     cnt_free = sds_buffer->buf_size - cnt_used;
 
     if (buf_size < cnt_free) {
@@ -185,20 +434,25 @@ int32_t sdsBufferWrite (sdsBufferId_t id, const void *buf, uint32_t buf_size) {
       num = cnt_free;
     }
 
-    cnt_limit = sds_buffer->buf_size - sds_buffer->idx_in;
+    idx       = sdsBufferIdxIn(sds_buffer, cnt_in);
+    cnt_limit = sds_buffer->buf_size - idx;
     if (num > cnt_limit) {
       // buffer rollover
-      memcpy(sds_buffer->buf + sds_buffer->idx_in, buf, cnt_limit);
+      memcpy(sds_buffer->buf + idx, buf, cnt_limit);
       memcpy(sds_buffer->buf, (const uint8_t *)buf + cnt_limit, num - cnt_limit);
-      sds_buffer->idx_in = num - cnt_limit;
     } else {
-      memcpy(sds_buffer->buf + sds_buffer->idx_in, buf, num);
-      sds_buffer->idx_in += num;
+      memcpy(sds_buffer->buf + idx, buf, num);
+    }
+    sdsBufferAdvanceIn(sds_buffer, idx, num);
+    // Publish data to consumer.
+    atomic_st32_release(&sds_buffer->cnt_in, cnt_in + num);
+
+    cnt_used_new = cnt_used + num;
+    if (cnt_used_new > sds_buffer->cnt_max) {
+      atomic_st32_release(&sds_buffer->cnt_max, cnt_used_new);
     }
-    sds_buffer->cnt_in += num;
 
     if ((sds_buffer->event_cb != NULL) && ((sds_buffer->event_mask & SDS_BUFFER_EVENT_DATA_HIGH) != 0U)) {
-      cnt_used_new = sds_buffer->cnt_in - sds_buffer->cnt_out;
       if ((cnt_used < sds_buffer->threshold_high) && (cnt_used_new >= sds_buffer->threshold_high)) {
         sds_buffer->event_cb(sds_buffer, SDS_BUFFER_EVENT_DATA_HIGH, sds_buffer->event_arg);
       }
@@ -214,12 +468,13 @@ int32_t sdsBufferWrite (sdsBufferId_t id, const void *buf, uint32_t buf_size) {
 int32_t sdsBufferRead (sdsBufferId_t id, void *buf, uint32_t buf_size) {
   sdsBuffer_t *sds_buffer = id;
   uint32_t     num = 0U;
-  uint32_t     cnt_used, cnt_used_new, cnt_limit;
+  uint32_t     cnt_out, cnt_used, cnt_used_new, cnt_limit, idx;
   int32_t      ret = SDS_ERROR_PARAMETER;
 
   if ((sds_buffer != NULL) && (buf != NULL) && (buf_size != 0U)) {
 
-    cnt_used = sds_buffer->cnt_in - sds_buffer->cnt_out;
+    cnt_out  = sds_buffer->cnt_out;
+    cnt_used = atomic_ld32_acquire(&sds_buffer->cnt_in) - cnt_out;
 
     if (buf_size < cnt_used) {
       num = buf_size;
@@ -228,20 +483,21 @@ int32_t sdsBufferRead (sdsBufferId_t id, void *buf, uint32_t buf_size) {
       num = cnt_used;
     }
 
-    cnt_limit = sds_buffer->buf_size - sds_buffer->idx_out;
+    idx       = sdsBufferIdxOut(sds_buffer, cnt_out);
+    cnt_limit = sds_buffer->buf_size - idx;
     if (num > cnt_limit) {
       // buffer rollover
-      memcpy(buf, sds_buffer->buf + sds_buffer->idx_out, cnt_limit);
+      memcpy(buf, sds_buffer->buf + idx, cnt_limit);
       memcpy((uint8_t *)buf + cnt_limit, sds_buffer->buf, num - cnt_limit);
-      sds_buffer->idx_out = num - cnt_limit;
     } else {
-      memcpy(buf, sds_buffer->buf + sds_buffer->idx_out, num);
-      sds_buffer->idx_out += num;
+      memcpy(buf, sds_buffer->buf + idx, num);
     }
-    sds_buffer->cnt_out += num;
+    sdsBufferAdvanceOut(sds_buffer, idx, num);
+    // Release buffer space to producer.
+    atomic_st32_release(&sds_buffer->cnt_out, cnt_out + num);
 
     if ((sds_buffer->event_cb != NULL) && ((sds_buffer->event_mask & SDS_BUFFER_EVENT_DATA_LOW) != 0U)) {
-      cnt_used_new = sds_buffer->cnt_in - sds_buffer->cnt_out;
+      cnt_used_new = cnt_used - num;
       if ((cnt_used > sds_buffer->threshold_low) && (cnt_used_new <= sds_buffer->threshold_low)) {
         sds_buffer->event_cb(sds_buffer, SDS_BUFFER_EVENT_DATA_LOW, sds_buffer->event_arg);
       }
@@ -252,24 +508,187 @@ int32_t sdsBufferRead (sdsBufferId_t id, void *buf, uint32_t buf_size) {
   return ret;
 }
 
+/**
+  Get free space region of SDS buffer stream for direct (zero-copy) write.
+*/
+int32_t sdsBufferWriteAcquire (sdsBufferId_t id, uint32_t offset, uint32_t size, sdsBufferRegion_t *region) {
+  sdsBuffer_t *sds_buffer = id;
+  uint32_t     num = 0U;
+  uint32_t     cnt_in, cnt_free;
+  int32_t      ret = SDS_ERROR_PARAMETER;
+
+  if ((sds_buffer != NULL) && (region != NULL)) {
+
+    cnt_in   = sds_buffer->cnt_in;
+    cnt_free = sds_buffer->buf_size - (cnt_in - atomic_ld32_acquire(&sds_buffer->cnt_out));
+
+    if (offset < cnt_free) {
+      num = cnt_free - offset;
+      if (size < num) {
+        num = size;
+      }
+    }
+    sdsBufferGetRegion(sds_buffer, sdsBufferIdxAdd(sds_buffer, sdsBufferIdxIn(sds_buffer, cnt_in), offset), num, region);
+
+    ret = (int32_t)num;
+  }
+  return ret;
+}
+
+/**
+  Commit data written directly to SDS buffer stream.
+*/
+int32_t sdsBufferWriteCommit (sdsBufferId_t id, uint32_t size) {
+  sdsBuffer_t *sds_buffer = id;
+  uint32_t     cnt_in, cnt_used, cnt_used_new;
+  int32_t      ret = SDS_ERROR_PARAMETER;
+
+  if (sds_buffer != NULL) {
+
+    cnt_in   = sds_buffer->cnt_in;
+    cnt_used = cnt_in - atomic_ld32_acquire(&sds_buffer->cnt_out);
+
+    if (size <= (sds_buffer->buf_size - cnt_used)) {
+      sdsBufferAdvanceIn(sds_buffer, sdsBufferIdxIn(sds_buffer, cnt_in), size);
+      // Publish data to consumer.
+      atomic_st32_release(&sds_buffer->cnt_in, cnt_in + size);
+
+      cnt_used_new = cnt_used + size;
+      if (cnt_used_new > sds_buffer->cnt_max) {
+        atomic_st32_release(&sds_buffer->cnt_max, cnt_used_new);
+      }
+
+      if ((sds_buffer->event_cb != NULL) && ((sds_buffer->event_mask & SDS_BUFFER_EVENT_DATA_HIGH) != 0U)) {
+        if ((cnt_used < sds_buffer->threshold_high) && (cnt_used_new >= sds_buffer->threshold_high)) {
+          sds_buffer->event_cb(sds_buffer, SDS_BUFFER_EVENT_DATA_HIGH, sds_buffer->event_arg);
+        }
+      }
+      ret = (int32_t)size;
+    }
+  }
+  return ret;
+}
+
+/**
+  Reserve space in SDS buffer stream for direct write (multi-producer).
+*/
+int32_t sdsBufferReserve (sdsBufferId_t id, uint32_t size, sdsBufferRegion_t *region) {
+  sdsBuffer_t *sds_buffer = id;
+  uint32_t     cnt_rsv;
+  int32_t      ret = SDS_ERROR_PARAMETER;
+
+  if ((sds_buffer != NULL) && (size != 0U) && (region != NULL)) {
+    if ((sds_buffer->buf_size & (sds_buffer->buf_size - 1U)) != 0U) {
+      // Buffer index is derived from cnt_rsv: buffer size must be a power of two.
+      return SDS_ERROR;
+    }
+
+    // Enter reservation before space is reserved (see sdsBufferLeave).
+    atomic_add32(&sds_buffer->nest, 1);
+
+    ret     = 0;
+    cnt_rsv = atomic_ld32(&sds_buffer->cnt_rsv);
+    while (size <= (sds_buffer->buf_size - (cnt_rsv - atomic_ld32_acquire(&sds_buffer->cnt_out)))) {
+      if (atomic_cas32(&sds_buffer->cnt_rsv, &cnt_rsv, cnt_rsv + size) != 0U) {
+        // Space is reserved: region is written by the caller and published with sdsBufferReserveCommit.
+        sdsBufferGetRegion(sds_buffer, cnt_rsv & (sds_buffer->buf_size - 1U), size, region);
+        ret = (int32_t)size;
+        break;
+      }
+    }
+
+    if (ret == 0) {
+      // Not enough space in buffer: leave reservation.
+      sdsBufferLeave(sds_buffer);
+    }
+  }
+  return ret;
+}
+
+/**
+  Commit data written to space reserved in SDS buffer stream (multi-producer).
+*/
+int32_t sdsBufferReserveCommit (sdsBufferId_t id) {
+  sdsBuffer_t *sds_buffer = id;
+  int32_t      ret = SDS_ERROR_PARAMETER;
+
+  if (sds_buffer != NULL) {
+    sdsBufferLeave(sds_buffer);
+    ret = SDS_OK;
+  }
+  return ret;
+}
+
+/**
+  Get data region of SDS buffer stream for direct (zero-copy) read.
+*/
+int32_t sdsBufferReadAcquire (sdsBufferId_t id, uint32_t offset, uint32_t size, sdsBufferRegion_t *region) {
+  sdsBuffer_t *sds_buffer = id;
+  uint32_t     num = 0U;
+  uint32_t     cnt_out, cnt_used;
+  int32_t      ret = SDS_ERROR_PARAMETER;
+
+  if ((sds_buffer != NULL) && (region != NULL)) {
+
+    cnt_out  = sds_buffer->cnt_out;
+    cnt_used = atomic_ld32_acquire(&sds_buffer->cnt_in) - cnt_out;
+
+    if (offset < cnt_used) {
+      num = cnt_used - offset;
+      if (size < num) {
+        num = size;
+      }
+    }
+    sdsBufferGetRegion(sds_buffer, sdsBufferIdxAdd(sds_buffer, sdsBufferIdxOut(sds_buffer, cnt_out), offset), num, region);
+
+    ret = (int32_t)num;
+  }
+  return ret;
+}
+
+/**
+  Release data read directly from SDS buffer stream.
+*/
+int32_t sdsBufferReadCommit (sdsBufferId_t id, uint32_t size) {
+  sdsBuffer_t *sds_buffer = id;
+  uint32_t     cnt_out, cnt_used, cnt_used_new;
+  int32_t      ret = SDS_ERROR_PARAMETER;
+
+  if (sds_buffer != NULL) {
+
+    cnt_out  = sds_buffer->cnt_out;
+    cnt_used = atomic_ld32_acquire(&sds_buffer->cnt_in) - cnt_out;
+
+    if (size <= cnt_used) {
+      sdsBufferAdvanceOut(sds_buffer, sdsBufferIdxOut(sds_buffer, cnt_out), size);
+      // Release buffer space to producer.
+      atomic_st32_release(&sds_buffer->cnt_out, cnt_out + size);
+
+      if ((sds_buffer->event_cb != NULL) && ((sds_buffer->event_mask & SDS_BUFFER_EVENT_DATA_LOW) != 0U)) {
+        cnt_used_new = cnt_used - size;
+        if ((cnt_used > sds_buffer->threshold_low) && (cnt_used_new <= sds_buffer->threshold_low)) {
+          sds_buffer->event_cb(sds_buffer, SDS_BUFFER_EVENT_DATA_LOW, sds_buffer->event_arg);
+        }
+      }
+      ret = (int32_t)size;
+    }
+  }
+  return ret;
+}
+
 /**
   Clear SDS buffer stream data.
 */
 int32_t sdsBufferClear (sdsBufferId_t id) {
   sdsBuffer_t *sds_buffer = id;
-  uint32_t     cnt_used, cnt_limit;
+  uint32_t     cnt_in, cnt_out;
   int32_t      ret = SDS_ERROR_PARAMETER;
 
   if (sds_buffer != NULL) {
-    cnt_used = sds_buffer->cnt_in - sds_buffer->cnt_out;
-    cnt_limit = sds_buffer->buf_size - sds_buffer->idx_out;
-    if (cnt_used > cnt_limit) {
-      // buffer rollover
-      sds_buffer->idx_out = cnt_used - cnt_limit;
-    } else {
-      sds_buffer->idx_out += cnt_used;
-    }
-    sds_buffer->cnt_out += cnt_used;
+    cnt_in  = atomic_ld32_acquire(&sds_buffer->cnt_in);
+    cnt_out = sds_buffer->cnt_out;
+    sdsBufferAdvanceOut(sds_buffer, sdsBufferIdxOut(sds_buffer, cnt_out), cnt_in - cnt_out);
+    atomic_st32_release(&sds_buffer->cnt_out, cnt_in);
 
     ret = SDS_OK;
   }
@@ -280,11 +699,47 @@ int32_t sdsBufferClear (sdsBufferId_t id) {
   Get data count in SDS buffer stream.
 */
 int32_t sdsBufferGetCount (sdsBufferId_t id) {
+  sdsBuffer_t *sds_buffer = id;
+  uint32_t     cnt_out;
+  int32_t      ret = SDS_ERROR_PARAMETER;
+
+  if (sds_buffer != NULL) {
+    // Load cnt_out before cnt_in: result is never negative, also when called
+    // from a thread which is neither producer nor consumer.
+    cnt_out = atomic_ld32_acquire(&sds_buffer->cnt_out);
+    ret     = (int32_t)(atomic_ld32_acquire(&sds_buffer->cnt_in) - cnt_out);
+  }
+  return ret;
+}
+
+/**
+  Get total number of data bytes written to and read from SDS buffer stream.
+*/
+int32_t sdsBufferGetCounters (sdsBufferId_t id, uint32_t *cnt_in, uint32_t *cnt_out) {
+  sdsBuffer_t *sds_buffer = id;
+  int32_t      ret = SDS_ERROR_PARAMETER;
+
+  if (sds_buffer != NULL) {
+    if (cnt_out != NULL) {
+      *cnt_out = atomic_ld32_acquire(&sds_buffer->cnt_out);
+    }
+    if (cnt_in != NULL) {
+      *cnt_in = atomic_ld32_acquire(&sds_buffer->cnt_in);
+    }
+    ret = SDS_OK;
+  }
+  return ret;
+}
+
+/**
+  Get maximum data count (high-water mark) in SDS buffer stream.
+*/
+int32_t sdsBufferGetMaxCount (sdsBufferId_t id) {
   sdsBuffer_t *sds_buffer = id;
   int32_t      ret = SDS_ERROR_PARAMETER;
 
   if (sds_buffer != NULL) {
-    ret = (int32_t)(sds_buffer->cnt_in - sds_buffer->cnt_out);
+    ret = (int32_t)atomic_ld32_acquire(&sds_buffer->cnt_max);
   }
   return ret;
 }
@@ -30,6 +30,14 @@ extern "C"
 
 typedef void *sdsBufferId_t;                        // Handle to SDS buffer stream
 
+// Buffer region: up to two contiguous segments (second segment is used on buffer rollover)
+typedef struct {
+  uint8_t  *buf1;                                   // Pointer to first segment
+  uint32_t  size1;                                  // Size of first segment in bytes
+  uint8_t  *buf2;                                   // Pointer to second segment (NULL when region does not roll over)
+  uint32_t  size2;                                  // Size of second segment in bytes
+} sdsBufferRegion_t;
+
 // Events
 #define SDS_BUFFER_EVENT_DATA_LOW       (1UL)       // Data size falls to or below low threshold
 #define SDS_BUFFER_EVENT_DATA_HIGH      (2UL)       // Data size reaches or exceeds high threshold
@@ -97,6 +105,71 @@ int32_t sdsBufferWrite (sdsBufferId_t id, const void *buf, uint32_t buf_size);
 */
 int32_t sdsBufferRead (sdsBufferId_t id, void *buf, uint32_t buf_size);
 
+/**
+  \fn          int32_t sdsBufferWriteAcquire (sdsBufferId_t id, uint32_t offset, uint32_t size, sdsBufferRegion_t *region)
+  \brief       Get free space region of SDS buffer stream for direct (zero-copy) write.
+  \param[in]   id             \ref sdsBufferId_t handle to SDS buffer stream
+  \param[in]   offset         offset in bytes from current write position
+  \param[in]   size           requested region size in bytes
+  \param[out]  region         pointer to \ref sdsBufferRegion_t receiving the region segments
+  \return      number of bytes in region (limited by free space) or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsBufferWriteAcquire (sdsBufferId_t id, uint32_t offset, uint32_t size, sdsBufferRegion_t *region);
+
+/**
+  \fn          int32_t sdsBufferWriteCommit (sdsBufferId_t id, uint32_t size)
+  \brief       Commit data written directly to SDS buffer stream.
+  \param[in]   id             \ref sdsBufferId_t handle to SDS buffer stream
+  \param[in]   size           number of bytes to commit from current write position
+  \return      number of data bytes committed or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsBufferWriteCommit (sdsBufferId_t id, uint32_t size);
+
+/**
+  \fn          int32_t sdsBufferReserve (sdsBufferId_t id, uint32_t size, sdsBufferRegion_t *region)
+  \brief       Reserve space in SDS buffer stream for direct write (multi-producer, buffer size must be a power of two).
+  \param[in]   id             \ref sdsBufferId_t handle to SDS buffer stream
+  \param[in]   size           number of bytes to reserve
+  \param[out]  region         pointer to \ref sdsBufferRegion_t receiving the region segments
+  \return      size when space is reserved, 0 when not enough space is available or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsBufferReserve (sdsBufferId_t id, uint32_t size, sdsBufferRegion_t *region);
+
+/**
+  \fn          int32_t sdsBufferReserveCommit (sdsBufferId_t id)
+  \brief       Commit data written to space reserved with \ref sdsBufferReserve (multi-producer).
+               Data is published in reservation order when all preceding reservations are committed.
+  \param[in]   id             \ref sdsBufferId_t handle to SDS buffer stream
+  \return      SDS_OK on success or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsBufferReserveCommit (sdsBufferId_t id);
+
+/**
+  \fn          int32_t sdsBufferReadAcquire (sdsBufferId_t id, uint32_t offset, uint32_t size, sdsBufferRegion_t *region)
+  \brief       Get data region of SDS buffer stream for direct (zero-copy) read.
+  \param[in]   id             \ref sdsBufferId_t handle to SDS buffer stream
+  \param[in]   offset         offset in bytes from current read position
+  \param[in]   size           requested region size in bytes
+  \param[out]  region         pointer to \ref sdsBufferRegion_t receiving the region segments
+  \return      number of bytes in region (limited by available data) or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsBufferReadAcquire (sdsBufferId_t id, uint32_t offset, uint32_t size, sdsBufferRegion_t *region);
+
+/**
+  \fn          int32_t sdsBufferReadCommit (sdsBufferId_t id, uint32_t size)
+  \brief       Release data read directly from SDS buffer stream.
+  \param[in]   id             \ref sdsBufferId_t handle to SDS buffer stream
+  \param[in]   size           number of bytes to release from current read position
+  \return      number of data bytes released or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsBufferReadCommit (sdsBufferId_t id, uint32_t size);
+
 /**
   \fn          int32_t sdsBufferClear (sdsBufferId_t id)
   \brief       Clear SDS buffer stream data.
@@ -115,6 +188,26 @@ int32_t sdsBufferClear (sdsBufferId_t id);
 */
 int32_t sdsBufferGetCount (sdsBufferId_t id);
 
+/**
+  \fn          int32_t sdsBufferGetCounters (sdsBufferId_t id, uint32_t *cnt_in, uint32_t *cnt_out)
+  \brief       Get total number of data bytes written to and read from SDS buffer stream.
+  \param[in]   id             \ref sdsBufferId_t handle to SDS buffer stream
+  \param[out]  cnt_in         pointer to variable receiving total bytes written (NULL if not used)
+  \param[out]  cnt_out        pointer to variable receiving total bytes read or cleared (NULL if not used)
+  \return      SDS_OK on success or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsBufferGetCounters (sdsBufferId_t id, uint32_t *cnt_in, uint32_t *cnt_out);
+
+/**
+  \fn          int32_t sdsBufferGetMaxCount (sdsBufferId_t id)
+  \brief       Get maximum data count (high-water mark) in SDS buffer stream since it was opened.
+  \param[in]   id             \ref sdsBufferId_t handle to SDS buffer stream
+  \return      maximum number of data bytes in buffer stream or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsBufferGetMaxCount (sdsBufferId_t id);
+
 #ifdef  __cplusplus
 }
 #endif
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SDS_INTERNAL_H
+#define SDS_INTERNAL_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+#include "sds.h"
+
+// ==== Synchronous Data Stream (SDS) functions used by SDSIO interfaces (not part of the SDS API) ====
+
+/**
+  \fn          int32_t sdsGetStatsByIndex (uint32_t index, void **sdsio_id, sdsStats_t *stats)
+  \brief       Get runtime statistics of SDS stream by stream index (used by sdsExchange).
+  \param[in]   index          SDS stream index (0 .. SDS_MAX_STREAMS-1)
+  \param[out]  sdsio_id       pointer to variable receiving the handle of the SDSIO stream used by the SDS stream
+  \param[out]  stats          pointer to \ref sdsStats_t receiving the statistics
+  \return      SDS_OK on success,
+               SDS_ERROR when SDS stream at index is not open or
+               SDS_ERROR_PARAMETER when index is out of range
+*/
+int32_t sdsGetStatsByIndex (uint32_t index, void **sdsio_id, sdsStats_t *stats);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* SDS_INTERNAL_H */
@@ -22,14 +22,18 @@
 #include <string.h>
 
 #include "cmsis_os2.h"
+#include "cmsis_compiler.h"
 
 #include "sds.h"
+#include "../../sds_internal.h"
 #include "sdsio.h"
 #include "sdsio_client.h"
+#include "sdsio_codec.h"
 
  // SDSIO header
 typedef struct {
-  uint32_t command;
+  uint16_t command;
+  uint16_t tag;                         // Request tag (request index + 1 and sequence number), 0 = without tag
   uint32_t sdsio_id;
   uint32_t argument;
   uint32_t data_size;
@@ -43,6 +47,19 @@ typedef struct {
 #define SDSIO_CMD_PING          5U
 #define SDSIO_CMD_FLAGS         6U
 #define SDSIO_CMD_INFO          7U
+#define SDSIO_CMD_STATS         8U
+#define SDSIO_CMD_SEEK          9U
+#define SDSIO_CMD_CREDIT        10U
+
+// SDSIO protocol version (major << 16 | minor)
+#define SDSIO_PROTOCOL_VERSION  0x00010000U
+
+// SDSIO features (capability exchange with SDSIO_CMD_PING)
+#define SDSIO_FEATURE_TAGS            (1UL << 0)        // Request tags
+#define SDSIO_FEATURE_READ_STREAMING  (1UL << 1)        // Streaming read mode (SDSIO_CMD_CREDIT)
+#define SDSIO_FEATURE_SEEK            (1UL << 2)        // Seek in read streams (SDSIO_CMD_SEEK)
+#define SDSIO_FEATURE_STATS           (1UL << 3)        // Stream statistics (SDSIO_CMD_STATS)
+#define SDSIO_FEATURE_CODEC           (1UL << 4)        // Payload codec of write streams
 
 static uint8_t sdsio_client_initialized = 0U;
 
@@ -54,22 +71,173 @@ static uint8_t sdsio_client_initialized = 0U;
 static volatile uint8_t sdsio_client_inactive_rx_cnt = 0U;
 static          uint8_t sdsio_client_error_data[SDSIO_CLIENT_ERROR_MAX_DATA_SIZE];
 
-// Ping Server retries
+// Stream statistics interval (number of sdsExchange calls between sending stream statistics)
+#ifndef SDSIO_CLIENT_STATS_INTERVAL
+#define SDSIO_CLIENT_STATS_INTERVAL     10U
+#endif
+
+static          uint32_t sdsio_client_stats_cnt = 0U;
+
+// Streaming read mode (0 = disabled, 1 = enabled)
+//  SDSIO-Server pushes data of streams opened for reading within the credit granted by the client,
+//  instead of responding to a SDSIO_CMD_READ request for each read.
+#ifndef SDSIO_CLIENT_READ_STREAMING
+#define SDSIO_CLIENT_READ_STREAMING     0
+#endif
+
+// Maximum number of streams in streaming read mode (further streams are read with SDSIO_CMD_READ requests)
+#ifndef SDSIO_CLIENT_READ_STREAMS
+#define SDSIO_CLIENT_READ_STREAMS       4U
+#endif
+
+#if (SDSIO_CLIENT_READ_STREAMING != 0)
+// Stream in streaming read mode
+typedef struct {
+  uint32_t   sdsio_id;                  // sdsio identifier (0 = entry is not used)
+  uint32_t   eos;                       // End of stream received
+  uint32_t   size;                      // Size of the region granted to SDSIO-Server (credit)
+  uint32_t   count;                     // Number of bytes received into the region
+  sdsioVec_t vec[2];                    // Region: free space of the caller's ring buffer (one or two buffers)
+} sdsio_client_stream_t;
+
+static sdsio_client_stream_t sdsio_client_stream[SDSIO_CLIENT_READ_STREAMS];
+#endif
+
+// Payload codec for write streams (0 = disabled, 1 = enabled)
+//  Data of streams opened with a codec (SDSIO_CODEC_xxx OR-ed to the mode) is encoded when SDSIO-Server
+//  accepts the codec on open, otherwise it is sent as is.
+#ifndef SDSIO_CLIENT_CODEC
+#define SDSIO_CLIENT_CODEC              0
+#endif
+
+// Maximum number of write streams with a payload codec (further streams are not encoded)
+#ifndef SDSIO_CLIENT_CODEC_STREAMS
+#define SDSIO_CLIENT_CODEC_STREAMS      4U
+#endif
+
+// Size of buffer for encoded data (SDSIO_CMD_WRITE data is encoded and sent in pieces of this size)
+#ifndef SDSIO_CLIENT_CODEC_BUF_SIZE
+#define SDSIO_CLIENT_CODEC_BUF_SIZE     1024U
+#endif
+#if ((SDSIO_CLIENT_CODEC_BUF_SIZE < 16U) || (SDSIO_CLIENT_CODEC_BUF_SIZE > 65536U))
+#error "SDSIO_CLIENT_CODEC_BUF_SIZE must be in range 16 to 65536"
+#endif
+
+// Maximum size of decoded data of one encoded SDSIO_CMD_WRITE command (24-bit size in the command argument)
+//  Larger commands are sent as is.
+#define SDSIO_CLIENT_CODEC_SIZE_MAX     0x00FFFFFFU
+
+#if (SDSIO_CLIENT_CODEC != 0)
+// Write stream with payload codec
+typedef struct {
+  uint32_t          sdsio_id;           // sdsio identifier (0 = entry is not used)
+  sdsioCodecState_t state;              // Codec state (codec identifier accepted by SDSIO-Server, see sdsio_codec.h)
+} sdsio_client_codec_t;
+
+static sdsio_client_codec_t sdsio_client_codec[SDSIO_CLIENT_CODEC_STREAMS];
+static uint8_t              sdsio_client_codec_buf[SDSIO_CLIENT_CODEC_BUF_SIZE];
+#endif
+
+// Maximum number of commands with a response in flight (request tags)
+//  Each command with a response carries a tag which SDSIO-Server returns in the response header.
+//  Responses are matched to the commands by the tag, so several threads can wait for responses at once.
+#ifndef SDSIO_CLIENT_MAX_REQUESTS
+#define SDSIO_CLIENT_MAX_REQUESTS       8U
+#endif
+#if (SDSIO_CLIENT_MAX_REQUESTS > 16U)
+#error "SDSIO_CLIENT_MAX_REQUESTS must not exceed 16"
+#endif
+
+// Request state
+#define SDSIO_REQUEST_FREE              0U
+#define SDSIO_REQUEST_PENDING           1U
+#define SDSIO_REQUEST_COMPLETED         2U
+
+// Request tag: request index + 1 in bits 0..4, sequence number in bits 5..15
+//  A response to a request which has timed out does not match a later request using the same entry.
+#define SDSIO_TAG_INDEX_Msk             0x1FU
+#define SDSIO_TAG_SEQ_Pos               5U
+
+// Command with a response in flight
+typedef struct {
+  volatile uint8_t  state;              // Request state (SDSIO_REQUEST_xxx)
+  uint8_t           reserved[3];
+  const sdsioVec_t *vec;                // Buffers for response data
+  uint32_t          vec_cnt;            // Number of buffers for response data
+  uint32_t          seq;                // Sequence number (order of commands sent)
+  int32_t           status;             // Number of response data bytes received or error
+  sdsio_header_t    header;             // Command header, replaced by the response header when completed
+} sdsio_client_request_t;
+
+static sdsio_client_request_t sdsio_client_request[SDSIO_CLIENT_MAX_REQUESTS];
+static uint32_t               sdsio_client_request_seq;
+
+// Maximum number of buffers (header and data) passed to sdsioClientSendv in one call
+#ifndef SDSIO_CLIENT_SEND_VEC_MAX
+#define SDSIO_CLIENT_SEND_VEC_MAX       4U
+#endif
+#if (SDSIO_CLIENT_SEND_VEC_MAX < 2U)
+#error "SDSIO_CLIENT_SEND_VEC_MAX must be at least 2"
+#endif
+
+// Staging buffer size for command header and small data (default sdsioClientSendv)
+#ifndef SDSIO_CLIENT_SEND_BUF_SIZE
+#define SDSIO_CLIENT_SEND_BUF_SIZE      64U
+#endif
+
+// Ping Server retries (maximum number of responses received at initialization until the SDSIO_CMD_PING response)
 #ifndef SDSIO_CLIENT_PING_RETRY
 #define SDSIO_CLIENT_PING_RETRY         10U
 #endif
 
-// Lock function
-#ifndef SDSIO_CLIENT_NO_LOCK
+// Maximum frame size (data size of one command or response) offered to SDSIO-Server with SDSIO_CMD_PING
+//  SDSIO-Server limits it to the maximum of the transport (for example 64 KB on Ethernet and USB, 8 KB on UART).
+//  The negotiated frame size is used by SDS as transfer size (see sdsioGetTransferSize).
+#ifndef SDSIO_CLIENT_MAX_FRAME_SIZE
+#define SDSIO_CLIENT_MAX_FRAME_SIZE     65536U
+#endif
+#if ((SDSIO_CLIENT_CODEC != 0) && (SDSIO_CLIENT_MAX_FRAME_SIZE > SDSIO_CLIENT_CODEC_SIZE_MAX))
+#error "SDSIO_CLIENT_MAX_FRAME_SIZE must not exceed 16 MB - 1 when SDSIO_CLIENT_CODEC is enabled"
+#endif
 
+// Capabilities of SDSIO-Server (SDSIO_CMD_PING response)
+typedef struct {
+  uint32_t response;                    // SDSIO_CMD_PING response received (0 = no response)
+  uint32_t version;                     // Protocol version (0 = capabilities not received)
+  uint32_t frame_size;                  // Negotiated frame size
+  uint32_t features;                    // Supported features (SDSIO_FEATURE_xxx)
+  uint32_t codecs;                      // Supported codec types (bit n = codec type n, see sdsio_codec.h)
+} sdsio_client_server_t;
+
+static sdsio_client_server_t sdsio_client_server;
+
+// Check if SDSIO-Server supports a feature (not supported until SDSIO-Server has returned its capabilities)
+#define SDSIO_SERVER_FEATURE(feature)   ((sdsio_client_server.version != 0U) && \
+                                         ((sdsio_client_server.features & (feature)) != 0U))
+
+// Response timeout (maximum time to wait for the response to a command)
+#ifndef SDSIO_CLIENT_RESPONSE_TIMEOUT
+#define SDSIO_CLIENT_RESPONSE_TIMEOUT   5000U
+#endif
+
+// Lock functions
+//  Send lock:    serializes sending of commands.
+//  Receive lock: held by the thread which receives from SDSIO-Server and dispatches the responses
+//                to the threads waiting for them (see sdsioClientTransfer).
 #ifndef SDSIO_CLIENT_LOCK_TIMEOUT
 #define SDSIO_CLIENT_LOCK_TIMEOUT       5000U
 #endif
 
-static osMutexId_t lock_id;
+#ifndef SDSIO_CLIENT_NO_LOCK
+
+static osMutexId_t      lock_id;
+static osMutexId_t      rx_lock_id;
+static osEventFlagsId_t rx_event_id;
 static inline int32_t sdsioLockCreate (void) {
-  lock_id = osMutexNew(NULL);
-  if (lock_id != NULL) {
+  lock_id     = osMutexNew(NULL);
+  rx_lock_id  = osMutexNew(NULL);
+  rx_event_id = osEventFlagsNew(NULL);
+  if ((lock_id != NULL) && (rx_lock_id != NULL) && (rx_event_id != NULL)) {
     return SDS_OK;
   } else {
     return SDS_ERROR_IO;
@@ -77,6 +245,8 @@ static inline int32_t sdsioLockCreate (void) {
 }
 static inline int32_t sdsioLockDelete (void) {
   osMutexDelete(lock_id);
+  osMutexDelete(rx_lock_id);
+  osEventFlagsDelete(rx_event_id);
   return SDS_OK;
 }
 static inline int32_t sdsioLock (void) {
@@ -96,68 +266,911 @@ static inline int32_t sdsioUnlock (void) {
   osMutexRelease(lock_id);
   return SDS_OK;
 }
+static inline int32_t sdsioRxLock (uint32_t timeout) {
+  osStatus_t  status;
+
+  status = osMutexAcquire(rx_lock_id, timeout);
+  if (status == osOK) {
+    return SDS_OK;
+  } else if ((status == osErrorTimeout) || (status == osErrorResource)) {
+    return SDS_ERROR_TIMEOUT;
+  } else {
+    return SDS_ERROR_IO;
+  }
+}
+static inline int32_t sdsioRxUnlock (void) {
+  osMutexRelease(rx_lock_id);
+  return SDS_OK;
+}
+static inline void sdsioRxNotify (uint32_t flags) {
+  osEventFlagsSet(rx_event_id, flags);
+}
+static inline void sdsioRxWait (uint32_t flags, uint32_t timeout) {
+  osEventFlagsWait(rx_event_id, flags, osFlagsWaitAny, timeout);
+}
 #else
 static inline int32_t sdsioLockCreate (void) { return SDS_OK; }
 static inline int32_t sdsioLockDelete (void) { return SDS_OK; }
 static inline int32_t sdsioLock       (void) { return SDS_OK; }
 static inline int32_t sdsioUnlock     (void) { return SDS_OK; }
+static inline int32_t sdsioRxLock     (uint32_t timeout) { (void)timeout; return SDS_OK; }
+static inline int32_t sdsioRxUnlock   (void) { return SDS_OK; }
+static inline void    sdsioRxNotify   (uint32_t flags) { (void)flags; }
+static inline void    sdsioRxWait     (uint32_t flags, uint32_t timeout) { (void)flags; (void)timeout; }
 #endif
 
 // Internal helper functions
 
+#if (SDSIO_CLIENT_READ_STREAMING != 0)
+/**
+  \fn          sdsio_client_stream_t *sdsioClientStream (uint32_t sdsio_id)
+  \brief       Get stream in streaming read mode.
+  \param[in]   sdsio_id     sdsio identifier
+  \return      pointer to stream or NULL if stream is not in streaming read mode
+*/
+static sdsio_client_stream_t *sdsioClientStream (uint32_t sdsio_id) {
+  uint32_t n;
+
+  if (sdsio_id != 0U) {
+    for (n = 0U; n < SDSIO_CLIENT_READ_STREAMS; n++) {
+      if (sdsio_client_stream[n].sdsio_id == sdsio_id) {
+        return &sdsio_client_stream[n];
+      }
+    }
+  }
+  return NULL;
+}
+
+/**
+  \fn          int32_t sdsioClientReceiveData (const sdsio_header_t *header)
+  \brief       Receive data pushed by SDSIO-Server into the region of the stream.
+  \param[in]   header       pointer to received header (SDSIO_CMD_CREDIT)
+  \return      SDS_OK on success or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+static int32_t sdsioClientReceiveData (const sdsio_header_t *header) {
+  sdsio_client_stream_t *stream;
+  uint8_t                discard[64];
+  uint32_t               size, ofs, num, n;
+  int32_t                ret = SDS_OK;
+
+  stream = sdsioClientStream(header->sdsio_id);
+  size   = header->data_size;
+
+  if ((stream != NULL) && (size <= (stream->size - stream->count))) {
+    // Receive data at the current position of the region.
+    ofs = stream->count;
+    for (n = 0U; (n < 2U) && (size != 0U) && (ret == SDS_OK); n++) {
+      num = stream->vec[n].buf_size;
+      if (ofs >= num) {
+        ofs -= num;
+        continue;
+      }
+      num -= ofs;
+      if (num > size) {
+        num = size;
+      }
+      ret = sdsioClientReceive((uint8_t *)stream->vec[n].buf + ofs, num, sdsioReceiveBlocking);
+      if (ret == (int32_t)num) {
+        stream->count += num;
+        size          -= num;
+        ofs            = 0U;
+        ret            = SDS_OK;
+      } else if (ret >= 0) {
+        // Incomplete data received.
+        ret = SDS_ERROR_IO;
+      }
+    }
+    if ((ret == SDS_OK) && (header->argument != 0U)) {
+      // End of stream.
+      stream->eos = 1U;
+    }
+  } else {
+    // Stream is closed (data was pushed before close) or data exceeds the credit: discard data.
+    if (stream != NULL) {
+      ret = SDS_ERROR_IO;
+    }
+    while (size != 0U) {
+      num = (size < sizeof(discard)) ? size : sizeof(discard);
+      if (sdsioClientReceive(discard, num, sdsioReceiveBlocking) != (int32_t)num) {
+        ret = SDS_ERROR_IO;
+        break;
+      }
+      size -= num;
+    }
+  }
+
+  return ret;
+}
+#endif
+
+/**
+  \fn          int32_t sdsioClientReceiveVec (const sdsioVec_t *vec, uint32_t vec_cnt, uint32_t size)
+  \brief       Receive response data into multiple buffers.
+  \param[in]   vec          pointer to array of buffers (NULL when no data is expected)
+  \param[in]   vec_cnt      number of buffers
+  \param[in]   size         number of data bytes in the response
+  \return      number of bytes stored in the buffers or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+static int32_t sdsioClientReceiveVec (const sdsioVec_t *vec, uint32_t vec_cnt, uint32_t size) {
+  uint8_t  discard[64];
+  uint32_t cnt = 0U;
+  uint32_t num, n;
+  int32_t  ret = SDS_OK;
+
+  // Receive data into buffers in sequence.
+  for (n = 0U; (vec != NULL) && (n < vec_cnt) && (size != 0U); n++) {
+    num = vec[n].buf_size;
+    if (num > size) {
+      num = size;
+    }
+    if (num == 0U) {
+      continue;
+    }
+    ret = sdsioClientReceive((uint8_t *)vec[n].buf, num, sdsioReceiveBlocking);
+    if (ret != (int32_t)num) {
+      break;
+    }
+    cnt  += num;
+    size -= num;
+  }
+
+  // Discard data which does not fit into the buffers.
+  while ((ret >= 0) && (size != 0U)) {
+    num = (size < sizeof(discard)) ? size : sizeof(discard);
+    ret = sdsioClientReceive(discard, num, sdsioReceiveBlocking);
+    if (ret != (int32_t)num) {
+      break;
+    }
+    size -= num;
+  }
+
+  if ((ret >= 0) && (size != 0U)) {
+    // Incomplete data received.
+    ret = SDS_ERROR_IO;
+  }
+  if (ret >= 0) {
+    ret = (int32_t)cnt;
+  }
+
+  return ret;
+}
+
+/**
+  \fn          int32_t sdsioClientReceivePing (const sdsio_header_t *header)
+  \brief       Receive SDSIO_CMD_PING response and store capabilities of SDSIO-Server.
+  \param[in]   header       pointer to received header
+  \return      SDS_OK on success or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+static int32_t sdsioClientReceivePing (const sdsio_header_t *header) {
+  uint32_t   data[2] = { 0U, 0U };      // Features, codecs
+  sdsioVec_t vec;
+  int32_t    ret;
+
+  vec.buf      = data;
+  vec.buf_size = sizeof(data);
+  ret = sdsioClientReceiveVec(&vec, 1U, header->data_size);
+  if ((ret >= 0) && (header->data_size == 0U)) {
+    // SDSIO-Server without capability exchange: no optional features.
+    sdsio_client_server.response = 1U;
+    ret = SDS_OK;
+  } else if (ret >= 0) {
+    sdsio_client_server.frame_size = header->argument;
+    if (sdsio_client_server.frame_size > SDSIO_CLIENT_MAX_FRAME_SIZE) {
+      sdsio_client_server.frame_size = SDSIO_CLIENT_MAX_FRAME_SIZE;
+    }
+    sdsio_client_server.features = data[0];
+    sdsio_client_server.codecs   = data[1];
+    sdsio_client_server.version  = (header->sdsio_id != 0U) ? header->sdsio_id : SDSIO_PROTOCOL_VERSION;
+    sdsio_client_server.response = 1U;
+    ret = SDS_OK;
+  }
+
+  return ret;
+}
+
+/**
+  \fn          int32_t sdsioClientProcessAsync (const sdsio_header_t *header)
+  \brief       Process asynchronous response (SDSIO_CMD_FLAGS, SDSIO_CMD_CREDIT or SDSIO_CMD_PING).
+  \param[in]   header       pointer to received header
+  \return      1 when asynchronous response is processed,
+               0 when header is a response to a command, or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+static int32_t sdsioClientProcessAsync (const sdsio_header_t *header) {
+  int32_t ret = 0;
+
+  if (header->command == SDSIO_CMD_FLAGS) {
+    // Flags response: update (modify) flags
+    if (header->data_size == 0U) {
+      sdsFlagsModify(header->sdsio_id, header->argument);
+      sdsio_client_inactive_rx_cnt = 0U;
+    }
+    ret = 1;
+  }
+  else if (header->command == SDSIO_CMD_PING) {
+    // Capabilities of SDSIO-Server (response to SDSIO_CMD_PING sent by sdsioInit)
+    ret = sdsioClientReceivePing(header);
+    if (ret == SDS_OK) {
+      ret = 1;
+    }
+  }
+#if (SDSIO_CLIENT_READ_STREAMING != 0)
+  else if (header->command == SDSIO_CMD_CREDIT) {
+    // Data pushed by SDSIO-Server
+    ret = sdsioClientReceiveData(header);
+    if (ret == SDS_OK) {
+      ret = 1;
+    }
+  }
+#endif
+
+  return ret;
+}
+
+/**
+  \fn          uint32_t sdsioClientRequestUntagged (uint32_t command)
+  \brief       Find the oldest command in flight sent without request tag (responses are returned in order).
+  \param[in]   command      command of the response
+  \return      request index or SDSIO_CLIENT_MAX_REQUESTS when no command is found
+*/
+static uint32_t sdsioClientRequestUntagged (uint32_t command) {
+  uint32_t index = SDSIO_CLIENT_MAX_REQUESTS;
+  uint32_t n;
+
+  for (n = 0U; n < SDSIO_CLIENT_MAX_REQUESTS; n++) {
+    if ((sdsio_client_request[n].state          == SDSIO_REQUEST_PENDING) &&
+        (sdsio_client_request[n].header.tag     == 0U)                    &&
+        (sdsio_client_request[n].header.command == command)) {
+      if ((index == SDSIO_CLIENT_MAX_REQUESTS) ||
+          ((int32_t)(sdsio_client_request[n].seq - sdsio_client_request[index].seq) < 0)) {
+        index = n;
+      }
+    }
+  }
+
+  return index;
+}
+
+/**
+  \fn          int32_t sdsioClientReceiveFrame (sdsioReceiveMode_t mode)
+  \brief       Receive one response from SDSIO-Server and dispatch it (called with receive lock).
+  \param[in]   mode         sdsioReceiveBlocking: wait for a response,
+                            sdsioReceiveNonBlocking: only when a response is already received
+  \return      1 when a response is dispatched,
+               0 when no response is received, or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+static int32_t sdsioClientReceiveFrame (sdsioReceiveMode_t mode) {
+  sdsio_client_request_t *request;
+  sdsio_header_t          header;
+  uint32_t                index = SDSIO_CLIENT_MAX_REQUESTS;
+  int32_t                 ret, num;
+#if (SDSIO_CLIENT_READ_STREAMING != 0)
+  sdsio_client_stream_t  *stream;
+#endif
+
+  ret = sdsioClientReceive((uint8_t *)&header, sizeof(header), mode);
+  if ((ret > 0) && (ret < (int32_t)sizeof(header))) {
+    // Header is partially received: receive the rest of the header.
+    num = ret;
+    ret = sdsioClientReceive((uint8_t *)&header + num, sizeof(header) - (uint32_t)num, sdsioReceiveBlocking);
+    if (ret > 0) {
+      ret += num;
+    }
+  }
+
+  if (ret == sizeof(header)) {
+    if (header.tag == 0U) {
+      // Asynchronous response.
+      ret = sdsioClientProcessAsync(&header);
+      if (ret == 0) {
+        // Response to a command sent without request tag.
+        index = sdsioClientRequestUntagged(header.command);
+      }
+    } else {
+      ret   = 0;
+      index = (header.tag & SDSIO_TAG_INDEX_Msk) - 1U;
+      if ((index >= SDSIO_CLIENT_MAX_REQUESTS) ||
+          (sdsio_client_request[index].state          != SDSIO_REQUEST_PENDING) ||
+          (sdsio_client_request[index].header.tag     != header.tag)            ||
+          (sdsio_client_request[index].header.command != header.command)) {
+        index = SDSIO_CLIENT_MAX_REQUESTS;
+      }
+    }
+    if (index < SDSIO_CLIENT_MAX_REQUESTS) {
+      // Response to a command: receive data into the buffers of the request and notify the waiting thread.
+      request = &sdsio_client_request[index];
+      request->status = sdsioClientReceiveVec(request->vec, request->vec_cnt, header.data_size);
+#if (SDSIO_CLIENT_READ_STREAMING != 0)
+      if (header.command == SDSIO_CMD_SEEK) {
+        stream = sdsioClientStream(header.sdsio_id);
+        if (stream != NULL) {
+          // SDSIO-Server has reset the credit: discard data pushed from the previous position.
+          stream->eos   = 0U;
+          stream->size  = 0U;
+          stream->count = 0U;
+        }
+      }
+#endif
+      ret = (request->status >= 0) ? 1 : request->status;
+      memcpy(&request->header, &header, sizeof(header));
+      request->state = SDSIO_REQUEST_COMPLETED;
+      sdsioRxNotify(1UL << index);
+    } else if (ret == 0) {
+      // Response does not match a command in flight (command has timed out): discard data.
+      ret = sdsioClientReceiveVec(NULL, 0U, header.data_size);
+      if (ret >= 0) {
+        ret = 1;
+      }
+    }
+  } else if (ret > 0) {
+    // Incomplete header received.
+    ret = SDS_ERROR_IO;
+  } else if (mode == sdsioReceiveNonBlocking) {
+    // No response received.
+    ret = 0;
+  }
+
+  return ret;
+}
+
 /**
-  \fn          int32_t sdsioClientReceiveHeader (uint8_t *buf, uint32_t buf_size)
-  \brief       Receive header from SDSIO-Server.
-  \param[out]  buf          pointer to the buffer where received header will be stored
-  \param[in]   buf_size     buffer size in bytes
-  \return      number of bytes successfully received or
-               a negative value on error (see \ref SDS_IO_Return_Codes)
+  \fn          int32_t sdsioClientDispatch (sdsioReceiveMode_t mode)
+  \brief       Receive and dispatch responses from SDSIO-Server (called with receive lock).
+  \param[in]   mode         sdsioReceiveNonBlocking: dispatch responses which are already received,
+                            sdsioReceiveBlocking: wait for one response, then dispatch responses already received
+  \return      SDS_OK on success or
+               a negative value on error (see \ref SDS_Return_Codes)
 */
-int32_t sdsioClientReceiveHeader (uint8_t *buf, uint32_t buf_size) {
+static int32_t sdsioClientDispatch (sdsioReceiveMode_t mode) {
+  int32_t ret;
+
+  do {
+    ret  = sdsioClientReceiveFrame(mode);
+    mode = sdsioReceiveNonBlocking;
+  } while (ret > 0);
+
+  return ret;
+}
+
+/**
+  \fn          void sdsioClientRxRelease (void)
+  \brief       Release receive lock and wake threads waiting for a response (one of them continues receiving).
+*/
+static void sdsioClientRxRelease (void) {
+  uint32_t flags = 0U;
+  uint32_t n;
+
+  sdsioRxUnlock();
+
+  for (n = 0U; n < SDSIO_CLIENT_MAX_REQUESTS; n++) {
+    if (sdsio_client_request[n].state == SDSIO_REQUEST_PENDING) {
+      flags |= 1UL << n;
+    }
+  }
+  if (flags != 0U) {
+    sdsioRxNotify(flags);
+  }
+}
+
+// Staging buffer of the default sdsioClientSendv (aligned for transports which send with DMA)
+static uint8_t sdsio_client_send_buf[SDSIO_CLIENT_SEND_BUF_SIZE] __ALIGNED(32);
+
+/**
+  \fn          int32_t sdsioClientSendv (const sdsioVec_t *vec, uint32_t vec_cnt)
+  \brief       Send data from multiple buffers to SDSIO-Server (gather, blocking).
+               Default for transports without gather send (weak, called with send lock): consecutive buffers
+               which fit into the staging buffer (command header and small data) are copied and sent with one
+               sdsioClientSend call, larger buffers are sent directly.
+  \param[in]   vec         pointer to array of buffers with data to send
+  \param[in]   vec_cnt     number of buffers in array
+  \return      number of bytes successfully sent or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+__WEAK int32_t sdsioClientSendv (const sdsioVec_t *vec, uint32_t vec_cnt) {
+  uint32_t num  = 0U;
+  uint32_t size = 0U;
+  uint32_t n;
+  int32_t  ret  = SDS_OK;
+
+  for (n = 0U; n <= vec_cnt; n++) {
+    if ((n < vec_cnt) && (vec[n].buf_size <= (sizeof(sdsio_client_send_buf) - size))) {
+      // Copy buffer to staging buffer.
+      if (vec[n].buf_size != 0U) {
+        memcpy(&sdsio_client_send_buf[size], vec[n].buf, vec[n].buf_size);
+        size += vec[n].buf_size;
+      }
+      continue;
+    }
+    if (size != 0U) {
+      // Send staging buffer.
+      ret = sdsioClientSend(sdsio_client_send_buf, size);
+      if (ret != (int32_t)size) {
+        if (ret > 0) {
+          num += (uint32_t)ret;
+        }
+        break;
+      }
+      num += size;
+      size = 0U;
+    }
+    if (n < vec_cnt) {
+      // Send buffer directly.
+      ret = sdsioClientSend((const uint8_t *)vec[n].buf, vec[n].buf_size);
+      if (ret != (int32_t)vec[n].buf_size) {
+        if (ret > 0) {
+          num += (uint32_t)ret;
+        }
+        break;
+      }
+      num += vec[n].buf_size;
+    }
+  }
+
+  if ((ret >= 0) || (num != 0U)) {
+    ret = (int32_t)num;
+  }
+
+  return ret;
+}
+
+/**
+  \fn          int32_t sdsioClientSendFrame (const sdsio_header_t *header, const sdsioVec_t *vec, uint32_t vec_cnt)
+  \brief       Send command header and data (called with send lock).
+               Header and data are passed to the transport in one sdsioClientSendv call
+               (more calls only when data consists of more than SDSIO_CLIENT_SEND_VEC_MAX - 1 buffers).
+  \param[in]   header       command header (data_size = total size of data in buffers)
+  \param[in]   vec          pointer to array of buffers with command data
+  \param[in]   vec_cnt      number of buffers
+  \return      SDS_OK on success or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+static int32_t sdsioClientSendFrame (const sdsio_header_t *header, const sdsioVec_t *vec, uint32_t vec_cnt) {
+  sdsioVec_t frame[SDSIO_CLIENT_SEND_VEC_MAX];
+  uint32_t   cnt, size, n;
+  int32_t    ret;
+
+  frame[0].buf      = (void *)(uintptr_t)header;
+  frame[0].buf_size = sizeof(sdsio_header_t);
+  cnt  = 1U;
+  size = sizeof(sdsio_header_t);
+  n    = 0U;
+
+  do {
+    // Gather header and data buffers.
+    while ((n < vec_cnt) && (cnt < SDSIO_CLIENT_SEND_VEC_MAX)) {
+      if (vec[n].buf_size != 0U) {
+        frame[cnt].buf      = vec[n].buf;
+        frame[cnt].buf_size = vec[n].buf_size;
+        size += vec[n].buf_size;
+        cnt++;
+      }
+      n++;
+    }
+    if (cnt == 0U) {
+      // Only empty buffers left.
+      ret = SDS_OK;
+      break;
+    }
+    ret = sdsioClientSendv(frame, cnt);
+    if (ret != (int32_t)size) {
+      if (ret >= 0) {
+        // Incomplete header or data sent.
+        ret = SDS_ERROR_IO;
+      }
+      break;
+    }
+    ret  = SDS_OK;
+    cnt  = 0U;
+    size = 0U;
+  } while (n < vec_cnt);
+
+  return ret;
+}
+
+#if (SDSIO_CLIENT_CODEC != 0)
+/**
+  \fn          int32_t sdsioClientSendEncoded (const sdsio_header_t *header, const sdsioVec_t *vec, uint32_t vec_cnt)
+  \brief       Send SDSIO_CMD_WRITE command with data encoded by the payload codec of the stream.
+               The size of the encoded data is determined first, then the data is encoded in pieces of up to
+               SDSIO_CLIENT_CODEC_BUF_SIZE bytes which are sent as the data of one command. The codec state is
+               carried across buffers and commands. Data which does not get smaller and commands with more than
+               SDSIO_CLIENT_CODEC_SIZE_MAX bytes of data are sent as is.
+               Streams without a payload codec are sent with sdsioClientSendFrame.
+  \param[in]   header       command header (data_size = total size of data in buffers)
+  \param[in]   vec          pointer to array of buffers with command data
+  \param[in]   vec_cnt      number of buffers
+  \return      SDS_OK on success or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+static int32_t sdsioClientSendEncoded (const sdsio_header_t *header, const sdsioVec_t *vec, uint32_t vec_cnt) {
+  sdsioCodecState_t *state = NULL;
+  sdsioCodecState_t  state_next;
+  const uint8_t     *data;
+  sdsio_header_t     frame;
+  sdsioVec_t         tx_vec[2];
+  uint32_t           size, left, num, len, enc_size, cnt, n;
+  int32_t            ret;
+
+  for (n = 0U; n < SDSIO_CLIENT_CODEC_STREAMS; n++) {
+    if (sdsio_client_codec[n].sdsio_id == header->sdsio_id) {
+      state = &sdsio_client_codec[n].state;
+      break;
+    }
+  }
+  if (state == NULL) {
+    // Stream without payload codec.
+    return sdsioClientSendFrame(header, vec, vec_cnt);
+  }
+
+  // Size of encoded data (codec state after the command).
+  state_next = *state;
+  enc_size   = 0U;
+  for (n = 0U; n < vec_cnt; n++) {
+    num       = vec[n].buf_size;
+    enc_size += sdsioCodecEncode(&state_next, (const uint8_t *)vec[n].buf, &num, NULL, 0U);
+  }
+  enc_size += sdsioCodecEncodeEnd(&state_next, NULL);
+  if ((enc_size >= header->data_size) || (header->data_size > SDSIO_CLIENT_CODEC_SIZE_MAX)) {
+    // Data does not get smaller or its size does not fit into the argument:
+    // send as is (state is updated as by encoding).
+    *state = state_next;
+    return sdsioClientSendFrame(header, vec, vec_cnt);
+  }
+
+  // Encoded data: argument = codec | size of decoded data.
+  frame           = *header;
+  frame.argument  = state->codec | (header->data_size << 8);
+  frame.data_size = enc_size;
+  tx_vec[0].buf      = &frame;
+  tx_vec[0].buf_size = sizeof(sdsio_header_t);
+  tx_vec[1].buf      = sdsio_client_codec_buf;
+  cnt  = 2U;
+  left = header->data_size;
+  ret  = SDS_OK;
+  for (n = 0U; (n < vec_cnt) && (ret == SDS_OK); n++) {
+    data = (const uint8_t *)vec[n].buf;
+    size = vec[n].buf_size;
+    while ((size != 0U) && (ret == SDS_OK)) {
+      // Encode piece (one byte is reserved for the end of the encoded data).
+      num  = size;
+      len  = sdsioCodecEncode(state, data, &num, sdsio_client_codec_buf, SDSIO_CLIENT_CODEC_BUF_SIZE - 1U);
+      data += num;
+      size -= num;
+      left -= num;
+      if (left == 0U) {
+        len += sdsioCodecEncodeEnd(state, &sdsio_client_codec_buf[len]);
+      }
+
+      // Send piece (the first one with the command header).
+      tx_vec[1].buf_size = len;
+      if (cnt == 2U) {
+        len += sizeof(sdsio_header_t);
+      }
+      if (len != 0U) {
+        if (sdsioClientSendv(&tx_vec[2U - cnt], cnt) != (int32_t)len) {
+          ret = SDS_ERROR_IO;
+        }
+        cnt = 1U;
+      }
+    }
+  }
+
+  return ret;
+}
+#endif
+
+/**
+  \fn          int32_t sdsioClientRequest (sdsio_header_t *header, const void *data, const sdsioVec_t *vec, uint32_t vec_cnt)
+  \brief       Send command with a response (the response is awaited with sdsioClientWait).
+  \param[in,out] header     command header (data_size = size of command data), tag is set to the request tag
+                            (0 when SDSIO-Server does not support request tags)
+  \param[in]   data         pointer to command data
+  \param[in]   vec          pointer to array of buffers for response data (NULL when response has no data)
+  \param[in]   vec_cnt      number of buffers
+  \return      request index or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+static int32_t sdsioClientRequest (sdsio_header_t *header, const void *data, const sdsioVec_t *vec, uint32_t vec_cnt) {
+  sdsio_client_request_t *request = NULL;
+  sdsioVec_t              tx_vec;
+  uint32_t                n;
+  int32_t                 ret;
+
+  ret = sdsioLock();
+  if (ret == SDS_OK) {
+    // Allocate request.
+    for (n = 0U; n < SDSIO_CLIENT_MAX_REQUESTS; n++) {
+      if (sdsio_client_request[n].state == SDSIO_REQUEST_FREE) {
+        request = &sdsio_client_request[n];
+        break;
+      }
+    }
+    if (request != NULL) {
+      request->seq     = sdsio_client_request_seq++;
+      header->tag      = 0U;
+      if (SDSIO_SERVER_FEATURE(SDSIO_FEATURE_TAGS)) {
+        header->tag    = (uint16_t)((n + 1U) | (request->seq << SDSIO_TAG_SEQ_Pos));
+      }
+      request->vec     = vec;
+      request->vec_cnt = vec_cnt;
+      request->status  = 0;
+      memcpy(&request->header, header, sizeof(sdsio_header_t));
+      request->state   = SDSIO_REQUEST_PENDING;
+
+      // Send header and data.
+      tx_vec.buf      = (void *)(uintptr_t)data;
+      tx_vec.buf_size = header->data_size;
+      ret = sdsioClientSendFrame(header, &tx_vec, 1U);
+      if (ret == SDS_OK) {
+        ret = (int32_t)n;
+      } else {
+        request->state = SDSIO_REQUEST_FREE;
+      }
+    } else {
+      // Maximum number of commands in flight reached.
+      ret = SDS_ERROR_IO;
+    }
+    sdsioUnlock();
+  }
+
+  return ret;
+}
+
+/**
+  \fn          int32_t sdsioClientWait (uint32_t index, sdsio_header_t *header)
+  \brief       Wait for the response to a command sent with sdsioClientRequest and release the request.
+               Threads wait for responses concurrently: the thread holding the receive lock
+               dispatches responses of other threads until its own response is received.
+               The request is released after SDSIO_CLIENT_RESPONSE_TIMEOUT also when no response is received
+               (a late response is discarded when it is received).
+  \param[in]   index        request index
+  \param[out]  header       response header
+  \return      number of response data bytes received or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+static int32_t sdsioClientWait (uint32_t index, sdsio_header_t *header) {
+  sdsio_client_request_t *request = &sdsio_client_request[index];
+  uint32_t                tick    = osKernelGetTickCount();
+  uint32_t                elapsed, timeout;
+  int32_t                 ret     = SDS_OK;
+
+  // Wait for response: receive from SDSIO-Server when no other thread is receiving,
+  // otherwise wait until the response is dispatched or the receiving thread releases the receive lock.
+  // The request is released with the receive lock held, so no response is dispatched to it meanwhile.
+  while (request->state != SDSIO_REQUEST_COMPLETED) {
+    elapsed = osKernelGetTickCount() - tick;
+    timeout = (elapsed < SDSIO_CLIENT_RESPONSE_TIMEOUT) ? (SDSIO_CLIENT_RESPONSE_TIMEOUT - elapsed) : 0U;
+    if (sdsioRxLock((timeout == 0U) ? SDSIO_CLIENT_LOCK_TIMEOUT : 0U) == SDS_OK) {
+      while ((request->state != SDSIO_REQUEST_COMPLETED) && (ret == SDS_OK)) {
+        if ((osKernelGetTickCount() - tick) >= SDSIO_CLIENT_RESPONSE_TIMEOUT) {
+          // No response received in time.
+          ret = SDS_ERROR_TIMEOUT;
+          break;
+        }
+        ret = sdsioClientReceiveFrame(sdsioReceiveBlocking);
+        if ((ret > 0) || (ret == SDS_ERROR_TIMEOUT)) {
+          // Response dispatched or no response yet: continue waiting.
+          ret = SDS_OK;
+        }
+      }
+      if (request->state != SDSIO_REQUEST_COMPLETED) {
+        request->state = SDSIO_REQUEST_FREE;
+      }
+      sdsioClientRxRelease();
+      break;
+    }
+    if (timeout == 0U) {
+      // Receive lock not released by the receiving thread.
+      ret = SDS_ERROR_TIMEOUT;
+      break;
+    }
+    sdsioRxWait(1UL << index, timeout);
+  }
+  if (request->state == SDSIO_REQUEST_COMPLETED) {
+    memcpy(header, &request->header, sizeof(sdsio_header_t));
+    ret = request->status;
+  }
+  request->state = SDSIO_REQUEST_FREE;
+
+  return ret;
+}
+
+/**
+  \fn          int32_t sdsioClientTransfer (sdsio_header_t *header, const void *data, const sdsioVec_t *vec, uint32_t vec_cnt)
+  \brief       Send command and wait for its response.
+  \param[in,out] header     command header (data_size = size of command data), replaced by the response header
+  \param[in]   data         pointer to command data
+  \param[in]   vec          pointer to array of buffers for response data (NULL when response has no data)
+  \param[in]   vec_cnt      number of buffers
+  \return      number of response data bytes received or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+static int32_t sdsioClientTransfer (sdsio_header_t *header, const void *data, const sdsioVec_t *vec, uint32_t vec_cnt) {
+  int32_t ret;
+
+  ret = sdsioClientRequest(header, data, vec, vec_cnt);
+  if (ret >= 0) {
+    ret = sdsioClientWait((uint32_t)ret, header);
+  }
+
+  return ret;
+}
+
+/**
+  \fn          int32_t sdsioClientSendPing (void)
+  \brief       Send SDSIO_CMD_PING command with capabilities of SDSIO-Client (see sdsioInit).
+               The response is processed as asynchronous response (see sdsioClientProcessAsync).
+  \return      SDS_OK on success or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+static int32_t sdsioClientSendPing (void) {
+  sdsio_header_t header;
+  uint32_t       data[2];
+  sdsioVec_t     vec;
   int32_t        ret;
-  uint32_t       set_mask;
-  uint32_t       clr_mask;
+
+  data[0] = SDSIO_FEATURE_TAGS | SDSIO_FEATURE_SEEK | SDSIO_FEATURE_STATS;
+#if (SDSIO_CLIENT_READ_STREAMING != 0)
+  data[0] |= SDSIO_FEATURE_READ_STREAMING;
+#endif
+  data[1] = 0U;
+#if (SDSIO_CLIENT_CODEC != 0)
+  data[0] |= SDSIO_FEATURE_CODEC;
+  data[1] |= 1UL << SDSIO_CODEC_TYPE_DELTA16;
+#endif
+  header.command   = SDSIO_CMD_PING;
+  header.tag       = 0U;
+  header.sdsio_id  = SDSIO_PROTOCOL_VERSION;
+  header.argument  = SDSIO_CLIENT_MAX_FRAME_SIZE;
+  header.data_size = sizeof(data);
+  vec.buf      = data;
+  vec.buf_size = sizeof(data);
+  ret = sdsioLock();
+  if (ret == SDS_OK) {
+    ret = sdsioClientSendFrame(&header, &vec, 1U);
+    sdsioUnlock();
+  }
+
+  return ret;
+}
+
+/**
+  \fn          int32_t sdsioClientOpenRequest (const char *name, sdsioMode_t mode, uint32_t *codec)
+  \brief       Send SDSIO_CMD_OPEN command (the response is awaited with sdsioClientOpenWait).
+  \param[in]   name         stream name
+  \param[in]   mode         open mode (write mode: optionally OR-ed with SDSIO_CODEC_xxx)
+  \param[out]  codec        requested payload codec (0 = none)
+  \return      request index or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+static int32_t sdsioClientOpenRequest (const char *name, sdsioMode_t mode, uint32_t *codec) {
+  sdsio_header_t header;
+
+  if (sdsio_client_server.response == 0U) {
+    // No capabilities of SDSIO-Server received yet (for example SDSIO-Server started after sdsioInit): send them again.
+    (void)sdsioClientSendPing();
+  }
+
+  *codec = 0U;
+#if (SDSIO_CLIENT_CODEC != 0)
+  if (((uint32_t)mode & SDSIO_MODE_Msk) == sdsioModeWrite) {
+    // Requested payload codec (when supported by SDSIO-Server).
+    *codec = ((uint32_t)mode & SDSIO_CODEC_Msk) >> SDSIO_CODEC_Pos;
+    if (!SDSIO_SERVER_FEATURE(SDSIO_FEATURE_CODEC) ||
+        ((sdsio_client_server.codecs & (1UL << (*codec & SDSIO_CODEC_TYPE_Msk))) == 0U)) {
+      *codec = 0U;
+    }
+  }
+#endif
+
+  header.command   = SDSIO_CMD_OPEN;
+  header.tag       = 0U;
+  header.sdsio_id  = *codec;
+  header.argument  = (uint32_t)mode & SDSIO_MODE_Msk;
+  header.data_size = strlen(name) + 1U;
+
+  return sdsioClientRequest(&header, name, NULL, 0U);
+}
+
+/**
+  \fn          uint32_t sdsioClientOpenWait (uint32_t index, sdsioMode_t mode, uint32_t codec)
+  \brief       Wait for the response to SDSIO_CMD_OPEN and set up payload codec and streaming read mode of the stream.
+  \param[in]   index        request index
+  \param[in]   mode         open mode
+  \param[in]   codec        requested payload codec (0 = none)
+  \return      sdsio identifier or 0 if operation failed
+*/
+static uint32_t sdsioClientOpenWait (uint32_t index, sdsioMode_t mode, uint32_t codec) {
   sdsio_header_t header;
+  uint32_t       sdsio_id = 0U;
+#if (SDSIO_CLIENT_READ_STREAMING != 0)
+  sdsio_client_stream_t *stream;
+#endif
+#if ((SDSIO_CLIENT_READ_STREAMING != 0) || (SDSIO_CLIENT_CODEC != 0))
+  uint32_t               n;
+#endif
+
+  mode = (sdsioMode_t)((uint32_t)mode & SDSIO_MODE_Msk);
 
-  if (buf_size < sizeof(header)) {
-    return SDS_ERROR_PARAMETER;
+  if (sdsioClientWait(index, &header) == 0) {
+    if ((header.command   == SDSIO_CMD_OPEN) &&
+        ((header.argument & SDSIO_MODE_Msk) == mode) &&
+        (header.data_size == 0U)) {
+      sdsio_id = header.sdsio_id;
+    }
   }
-
-  do {
-    // Receive header
-    ret = sdsioClientReceive((uint8_t *)&header, sizeof(header), sdsioReceiveBlocking);
-    if (ret == sizeof(header)) {
-      // If header is flags response, process it and update (modify) flags
-      if (header.command == SDSIO_CMD_FLAGS) {
-        if (header.data_size == 0U) {
-          set_mask = header.sdsio_id;
-          clr_mask = header.argument;
-          sdsFlagsModify(set_mask, clr_mask);
-          sdsio_client_inactive_rx_cnt = 0U;
-        }
-      } else {
-        // Not async flags response but expected response to a command, return it
-        memcpy(buf, &header, sizeof(header));
+#if (SDSIO_CLIENT_CODEC != 0)
+  if ((sdsio_id != 0U) && (codec != 0U) &&
+      (((header.argument & SDSIO_CODEC_Msk) >> SDSIO_CODEC_Pos) == codec) && (sdsioLock() == SDS_OK)) {
+    // Codec accepted by SDSIO-Server (not accepted by SDSIO-Server without codec support):
+    // encode data when a free entry is available.
+    for (n = 0U; n < SDSIO_CLIENT_CODEC_STREAMS; n++) {
+      if (sdsio_client_codec[n].sdsio_id == 0U) {
+        sdsio_client_codec[n].sdsio_id = sdsio_id;
+        sdsioCodecInit(&sdsio_client_codec[n].state, codec);
+        break;
+      }
+    }
+    sdsioUnlock();
+  }
+#else
+  (void)codec;
+#endif
+#if (SDSIO_CLIENT_READ_STREAMING != 0)
+  if ((sdsio_id != 0U) && (mode == sdsioModeRead) && SDSIO_SERVER_FEATURE(SDSIO_FEATURE_READ_STREAMING) &&
+      (sdsioRxLock(SDSIO_CLIENT_LOCK_TIMEOUT) == SDS_OK)) {
+    // Read stream in streaming read mode when a free entry is available.
+    stream = NULL;
+    for (n = 0U; n < SDSIO_CLIENT_READ_STREAMS; n++) {
+      if (sdsio_client_stream[n].sdsio_id == 0U) {
+        stream = &sdsio_client_stream[n];
         break;
       }
-    } else if (ret >= 0) {
-      // Incomplete header received.
-      ret = SDS_ERROR_IO;
-      break;
     }
-  } while (true);
+    if (stream != NULL) {
+      memset(stream, 0, sizeof(sdsio_client_stream_t));
+      stream->sdsio_id = sdsio_id;
+    }
+    sdsioClientRxRelease();
+  }
+#endif
 
-  return ret;
+  return sdsio_id;
 }
 
-
 // SDSIO functions
 
 /**
   Initialize SDSIO interface.
+  Exchange capabilities with SDSIO-Server:
+  Send:
+    header: command   = SDSIO_CMD_PING
+            tag       = 0
+            sdsio_id  = protocol version of SDSIO-Client
+            argument  = maximum frame size of SDSIO-Client
+            data_size = 8
+    data:   features used by SDSIO-Client (SDSIO_FEATURE_xxx), codec types supported by SDSIO-Client
+  Receive:
+    header: command   = SDSIO_CMD_PING
+            tag       = 0
+            sdsio_id  = protocol version of SDSIO-Server
+            argument  = negotiated frame size
+            data_size = 8
+    data:   features supported by SDSIO-Server, codec types supported by SDSIO-Server
+  SDSIO-Server without capability exchange ignores the data and responds with data_size = 0.
+  The response is awaited for up to SDSIO_CLIENT_PING_RETRY received responses or one receive timeout.
+  Until the capabilities of SDSIO-Server are received, SDSIO-Client uses no optional features (commands are sent
+  without request tag) and sdsioGetTransferSize returns 0 (SDS uses SDS_IO_TRANSFER_SIZE). SDSIO_CMD_PING is sent
+  again with each open command until a response is received; a response received later is processed as an
+  asynchronous response and applies to streams opened afterwards.
 */
 int32_t sdsioInit (void) {
-  int32_t ret;
+  uint32_t n;
+  int32_t  ret;
 
   if (sdsio_client_initialized != 0U) {
     // SDSIO-Client already initialized.
@@ -172,7 +1185,40 @@ int32_t sdsioInit (void) {
   if (ret != SDS_OK) {
     sdsioLockDelete();
   } else {
-    sdsio_client_initialized = 1U;
+    memset(sdsio_client_request, 0, sizeof(sdsio_client_request));
+#if (SDSIO_CLIENT_READ_STREAMING != 0)
+    memset(sdsio_client_stream, 0, sizeof(sdsio_client_stream));
+#endif
+#if (SDSIO_CLIENT_CODEC != 0)
+    memset(sdsio_client_codec, 0, sizeof(sdsio_client_codec));
+#endif
+    memset(&sdsio_client_server, 0, sizeof(sdsio_client_server));
+
+    // Send capabilities of SDSIO-Client.
+    ret = sdsioClientSendPing();
+
+    // Receive capabilities of SDSIO-Server (asynchronous response, see sdsioClientProcessAsync).
+    if ((ret == SDS_OK) && (sdsioRxLock(SDSIO_CLIENT_LOCK_TIMEOUT) == SDS_OK)) {
+      for (n = 0U; (n < SDSIO_CLIENT_PING_RETRY) && (sdsio_client_server.response == 0U); n++) {
+        ret = sdsioClientReceiveFrame(sdsioReceiveBlocking);
+        if (ret < 0) {
+          break;
+        }
+        ret = SDS_OK;
+      }
+      sdsioClientRxRelease();
+      if (ret == SDS_ERROR_TIMEOUT) {
+        // No response from SDSIO-Server (yet): continue without capabilities.
+        ret = SDS_OK;
+      }
+    }
+
+    if (ret == SDS_OK) {
+      sdsio_client_initialized = 1U;
+    } else {
+      sdsioClientUninit();
+      sdsioLockDelete();
+    }
   }
 
   return ret;
@@ -194,26 +1240,36 @@ int32_t sdsioUninit (void) {
   return SDS_OK;
 }
 
+/**
+  Get efficient transfer size of SDSIO interface.
+*/
+uint32_t sdsioGetTransferSize (void) {
+
+  // Frame size negotiated with SDSIO-Server (0 = no capabilities received).
+  return sdsio_client_server.frame_size;
+}
+
 /**
   Open SDSIO stream.
   Send:
     header: command   = SDSIO_CMD_OPEN
-            sdsio_id  = not used
+            tag       = request tag
+            sdsio_id  = requested payload codec (see sdsio_codec.h), 0 = none
             argument  = sdsioMode_t
             data_size = size of stream name
     data:   stream name
   Receive:
     header: command   = SDSIO_CMD_OPEN
+            tag       = request tag
             sdsio_id  = retrieved sdsio identifier
-            argument  = sdsioMode_t
+            argument  = sdsioMode_t | (accepted payload codec << 8)
             data_size = 0
     data:   no data
 */
 sdsioId_t sdsioOpen (const char *name, sdsioMode_t mode) {
-  uint32_t       sdsio_id = 0U;
-  int32_t        ret = SDS_ERROR_IO;
-  int32_t        data_size;
-  sdsio_header_t header;
+  uint32_t sdsio_id = 0U;
+  uint32_t codec;
+  int32_t  ret;
 
   if (sdsio_client_initialized == 0U) {
     // SDSIO-Client not initialized.
@@ -221,36 +1277,66 @@ sdsioId_t sdsioOpen (const char *name, sdsioMode_t mode) {
   }
 
   if (name != NULL) {
-    if (sdsioLock() == SDS_OK) {
-      data_size = (int32_t)strlen(name) + 1;
-      header.command   = SDSIO_CMD_OPEN;
-      header.sdsio_id  = 0U;
-      header.argument  = mode;
-      header.data_size = data_size;
+    // Send command and receive response.
+    ret = sdsioClientOpenRequest(name, mode, &codec);
+    if (ret >= 0) {
+      sdsio_id = sdsioClientOpenWait((uint32_t)ret, mode, codec);
+    }
+  }
 
-      // Send header.
-      ret = sdsioClientSend((const uint8_t *)&header, sizeof(header));
-      if (ret == sizeof(header)) {
-        // Send data.
-        ret = sdsioClientSend((const uint8_t *)name, data_size);
-      }
-      // Receive header.
-      if (ret == data_size) {
-        ret = sdsioClientReceiveHeader((uint8_t *)&header, sizeof(header));
-        if (ret == sizeof(header)) {
-          if ((header.command   == SDSIO_CMD_OPEN) &&
-              (header.argument  == mode)           &&
-              (header.data_size == 0U)) {
-            sdsio_id = header.sdsio_id;
-          }
-        }
+  return (sdsioId_t)(uintptr_t)sdsio_id;
+}
+
+/**
+  Open a group of SDSIO streams.
+  SDSIO_CMD_OPEN commands (see sdsioOpen) are sent for up to SDSIO_CLIENT_MAX_REQUESTS streams
+  before the responses are awaited, so the streams are opened with one round trip.
+*/
+int32_t sdsioOpenGroup (sdsioOpenParam_t *param, uint32_t cnt) {
+  int32_t  index[SDSIO_CLIENT_MAX_REQUESTS];
+  uint32_t codec[SDSIO_CLIENT_MAX_REQUESTS];
+  uint32_t n, i, num;
+  int32_t  ret = SDS_OK;
+
+  if (sdsio_client_initialized == 0U) {
+    // SDSIO-Client not initialized.
+    return SDS_ERROR_IO;
+  }
+  if (param == NULL) {
+    // Invalid parameter.
+    return SDS_ERROR_PARAMETER;
+  }
+
+  for (n = 0U; n < cnt; n += num) {
+    num = cnt - n;
+    if (num > SDSIO_CLIENT_MAX_REQUESTS) {
+      num = SDSIO_CLIENT_MAX_REQUESTS;
+    }
+
+    // Send open commands.
+    for (i = 0U; i < num; i++) {
+      index[i] = SDS_ERROR_PARAMETER;
+      if (param[n + i].name != NULL) {
+        index[i] = sdsioClientOpenRequest(param[n + i].name, param[n + i].mode, &codec[i]);
       }
+    }
 
-      sdsioUnlock();
+    // Wait for responses; open streams one after another when all requests are in use by other threads.
+    for (i = 0U; i < num; i++) {
+      if (index[i] >= 0) {
+        param[n + i].id = (sdsioId_t)(uintptr_t)sdsioClientOpenWait((uint32_t)index[i], param[n + i].mode, codec[i]);
+      } else if (index[i] == SDS_ERROR_IO) {
+        param[n + i].id = sdsioOpen(param[n + i].name, param[n + i].mode);
+      } else {
+        param[n + i].id = NULL;
+      }
+      if (param[n + i].id == NULL) {
+        ret = SDS_ERROR;
+      }
     }
   }
 
-  return (sdsioId_t)sdsio_id;
+  return ret;
 }
 
 /**
@@ -265,6 +1351,12 @@ sdsioId_t sdsioOpen (const char *name, sdsioMode_t mode) {
 int32_t sdsioClose (sdsioId_t id) {
   int32_t        ret = SDS_ERROR_IO;
   sdsio_header_t header;
+#if (SDSIO_CLIENT_READ_STREAMING != 0)
+  sdsio_client_stream_t *stream;
+#endif
+#if (SDSIO_CLIENT_CODEC != 0)
+  uint32_t               n;
+#endif
 
   if (sdsio_client_initialized == 0U) {
     // SDSIO-Client not initialized.
@@ -272,21 +1364,35 @@ int32_t sdsioClose (sdsioId_t id) {
   }
 
   if (id != NULL) {
+#if (SDSIO_CLIENT_READ_STREAMING != 0)
+    ret = sdsioRxLock(SDSIO_CLIENT_LOCK_TIMEOUT);
+    if (ret == SDS_OK) {
+      stream = sdsioClientStream((uint32_t)(uintptr_t)id);
+      if (stream != NULL) {
+        // Release the region: data pushed before SDSIO-Server processes the close command is discarded.
+        memset(stream, 0, sizeof(sdsio_client_stream_t));
+      }
+      sdsioClientRxRelease();
+    }
+#endif
     ret = sdsioLock();
     if (ret == SDS_OK) {
+#if (SDSIO_CLIENT_CODEC != 0)
+      for (n = 0U; n < SDSIO_CLIENT_CODEC_STREAMS; n++) {
+        if (sdsio_client_codec[n].sdsio_id == (uint32_t)(uintptr_t)id) {
+          // Release payload codec entry.
+          sdsio_client_codec[n].sdsio_id = 0U;
+        }
+      }
+#endif
       header.command   = SDSIO_CMD_CLOSE;
-      header.sdsio_id  = (uint32_t)id;
+      header.tag       = 0U;
+      header.sdsio_id  = (uint32_t)(uintptr_t)id;
       header.argument  = 0U;
       header.data_size = 0U;
 
-      // Send Header.
-      ret = sdsioClientSend((const uint8_t *)&header, sizeof(header));
-      if (ret == sizeof(header)) {
-        ret = SDS_OK;
-      } else if (ret >= 0) {
-        // Incomplete header sent.
-        ret = SDS_ERROR_IO;
-      }
+      // Send header.
+      ret = sdsioClientSendFrame(&header, NULL, 0U);
       sdsioUnlock();
     }
   } else {
@@ -299,15 +1405,45 @@ int32_t sdsioClose (sdsioId_t id) {
 
 /**
   Write data to SDSIO stream.
+*/
+int32_t sdsioWrite (sdsioId_t id, const void *buf, uint32_t buf_size) {
+  sdsioVec_t vec;
+
+  vec.buf      = (void *)buf;
+  vec.buf_size = buf_size;
+
+  return sdsioWritev(id, &vec, 1U);
+}
+
+/**
+  Read data from SDSIO stream.
+*/
+int32_t sdsioRead (sdsioId_t id, void *buf, uint32_t buf_size) {
+  sdsioVec_t vec;
+
+  vec.buf      = buf;
+  vec.buf_size = buf_size;
+
+  return sdsioReadv(id, &vec, 1U);
+}
+
+/**
+  Write data from multiple buffers to SDSIO stream.
   Send:
     header: command   = SDSIO_CMD_WRITE
             sdsio_id  = sdsio identifier
             argument  = not used
-            data_size = number of data bytes
-    data:   data to be written
+            data_size = number of data bytes (sum of all buffer sizes)
+    data:   data to be written (all buffers in sequence)
+  Streams with a payload codec (SDSIO_CLIENT_CODEC) send the data encoded (codec state carried across commands):
+    header: argument  = codec | (number of decoded data bytes << 8), 0 = data is not encoded
+            data_size = number of encoded data bytes
+    data:   encoded data
 */
-int32_t sdsioWrite (sdsioId_t id, const void *buf, uint32_t buf_size) {
+int32_t sdsioWritev (sdsioId_t id, const sdsioVec_t *vec, uint32_t vec_cnt) {
   int32_t        ret = SDS_ERROR_IO;
+  uint32_t       buf_size = 0U;
+  uint32_t       n;
   sdsio_header_t header;
 
   if (sdsio_client_initialized == 0U) {
@@ -315,26 +1451,37 @@ int32_t sdsioWrite (sdsioId_t id, const void *buf, uint32_t buf_size) {
     return SDS_ERROR_IO;
   }
 
-  if ((id != NULL) && (buf != NULL) && (buf_size != 0U)) {
+  if ((vec != NULL) && (vec_cnt != 0U)) {
+    // Get number of bytes to write.
+    for (n = 0U; n < vec_cnt; n++) {
+      if ((vec[n].buf == NULL) && (vec[n].buf_size != 0U)) {
+        break;
+      }
+      buf_size += vec[n].buf_size;
+    }
+    if (n != vec_cnt) {
+      // Invalid buffer.
+      buf_size = 0U;
+    }
+  }
+
+  if ((id != NULL) && (buf_size != 0U)) {
     ret = sdsioLock();
     if (ret == SDS_OK) {
       header.command   = SDSIO_CMD_WRITE;
-      header.sdsio_id  = (uint32_t)id;
+      header.tag       = 0U;
+      header.sdsio_id  = (uint32_t)(uintptr_t)id;
       header.argument  = 0U;
       header.data_size = buf_size;
 
-      // Send header.
-      ret = sdsioClientSend((const uint8_t *)&header, sizeof(header));
-      if (ret == sizeof(header)) {
-        // Send data.
-        ret = sdsioClientSend((const uint8_t *)buf, buf_size);
-        if ((ret >= 0) && (ret < (int32_t)buf_size)) {
-          // Incomplete data sent.
-          ret = SDS_ERROR_IO;
-        }
-      } else if (ret >= 0) {
-        // Incomplete header sent.
-        ret = SDS_ERROR_IO;
+      // Send header and data from all buffers.
+#if (SDSIO_CLIENT_CODEC != 0)
+      ret = sdsioClientSendEncoded(&header, vec, vec_cnt);
+#else
+      ret = sdsioClientSendFrame(&header, vec, vec_cnt);
+#endif
+      if (ret == SDS_OK) {
+        ret = (int32_t)buf_size;
       }
       sdsioUnlock();
     }
@@ -346,78 +1493,256 @@ int32_t sdsioWrite (sdsioId_t id, const void *buf, uint32_t buf_size) {
   return ret;
 }
 
+#if (SDSIO_CLIENT_READ_STREAMING != 0)
 /**
-  Read data from SDSIO stream.
+  Read data from SDSIO stream in streaming read mode.
+  Buffers are the free space of a ring buffer and each call continues at the position
+  following the data returned by the previous call (as read by SDS). The buffers are granted
+  to SDSIO-Server as credit and SDSIO-Server pushes data into them without a request per read.
+  Called with receive lock (pushed data is received also by threads waiting for responses).
+  Send (when the buffers are larger than the granted region):
+    header: command   = SDSIO_CMD_CREDIT
+            sdsio_id  = sdsio identifier
+            argument  = number of bytes by which the credit is increased
+            data_size = 0
+    data:   no data
+  Receive (asynchronous response, processed also while waiting for responses to other commands):
+    header: command   = SDSIO_CMD_CREDIT
+            sdsio_id  = sdsio identifier
+            argument  = nonzero = end of stream, else 0
+            data_size = number of data bytes (up to the remaining credit)
+    data:   data read (distributed to granted region)
+*/
+static int32_t sdsioReadStream (sdsio_client_stream_t *stream, const sdsioVec_t *vec, uint32_t vec_cnt) {
+  int32_t        ret = SDS_OK;
+  uint32_t       size, num;
+  sdsio_header_t header;
+
+  // Get size of the region (up to two buffers).
+  size = vec[0].buf_size;
+  if (vec_cnt > 1U) {
+    size += vec[1].buf_size;
+  }
+
+  if ((stream->size != 0U) && (vec[0].buf != stream->vec[0].buf)) {
+    // Buffers do not continue the region granted to SDSIO-Server.
+    ret = SDS_ERROR_IO;
+  }
+
+  if ((ret == SDS_OK) && (size > stream->size)) {
+    // Extend the region and grant the additional space to SDSIO-Server.
+    header.command   = SDSIO_CMD_CREDIT;
+    header.tag       = 0U;
+    header.sdsio_id  = stream->sdsio_id;
+    header.argument  = size - stream->size;
+    header.data_size = 0U;
+
+    // Send header.
+    ret = sdsioLock();
+    if (ret == SDS_OK) {
+      ret = sdsioClientSendFrame(&header, NULL, 0U);
+      sdsioUnlock();
+    }
+    if (ret == SDS_OK) {
+      stream->vec[0] = vec[0];
+      if (vec_cnt > 1U) {
+        stream->vec[1] = vec[1];
+      } else {
+        stream->vec[1].buf      = NULL;
+        stream->vec[1].buf_size = 0U;
+      }
+      stream->size = size;
+      ret = SDS_OK;
+    } else if (ret >= 0) {
+      // Incomplete header sent.
+      ret = SDS_ERROR_IO;
+    }
+  }
+
+  if (ret == SDS_OK) {
+    // Receive pushed data: wait for a response only when no data has been received for the stream.
+    if ((stream->count == 0U) && (stream->eos == 0U)) {
+      ret = sdsioClientDispatch(sdsioReceiveBlocking);
+    } else {
+      ret = sdsioClientDispatch(sdsioReceiveNonBlocking);
+    }
+  }
+
+  if (ret == SDS_OK) {
+    num = stream->count;
+    if (num > size) {
+      num = size;
+    }
+    if (num != 0U) {
+      // Return received data and continue the region after it.
+      stream->size  -= num;
+      stream->count -= num;
+      ret = (int32_t)num;
+      if (num >= stream->vec[0].buf_size) {
+        num -= stream->vec[0].buf_size;
+        stream->vec[0]          = stream->vec[1];
+        stream->vec[1].buf      = NULL;
+        stream->vec[1].buf_size = 0U;
+      }
+      if (num != 0U) {
+        stream->vec[0].buf       = (uint8_t *)stream->vec[0].buf + num;
+        stream->vec[0].buf_size -= num;
+      }
+    } else if (stream->eos != 0U) {
+      // End of stream.
+      ret = SDS_EOS;
+    }
+  }
+
+  return ret;
+}
+#endif
+
+/**
+  Read data from SDSIO stream into multiple buffers.
   Send:
     header: command   = SDSIO_CMD_READ
+            tag       = request tag
             sdsio_id  = sdsio identifier
-            argument  = number of bytes to be read
+            argument  = number of bytes to be read (sum of all buffer sizes)
             data_size = 0
     data:   no data
   Receive:
     header: command   = SDSIO_CMD_READ
+            tag       = request tag
             sdsio_id  = sdsio identifier
             argument  = nonzero = end of stream, else 0
             data_size = number of data bytes read
-    data    data read
+    data    data read (distributed to buffers in sequence)
+  Streams in streaming read mode (SDSIO_CLIENT_READ_STREAMING) are read with sdsioReadStream.
 */
-int32_t sdsioRead (sdsioId_t id, void *buf, uint32_t buf_size) {
+int32_t sdsioReadv (sdsioId_t id, const sdsioVec_t *vec, uint32_t vec_cnt) {
   int32_t        ret = SDS_ERROR_IO;
-  uint32_t       size;
+  uint32_t       buf_size = 0U;
+  uint32_t       n;
   sdsio_header_t header;
+#if (SDSIO_CLIENT_READ_STREAMING != 0)
+  sdsio_client_stream_t *stream;
+#endif
 
   if (sdsio_client_initialized == 0U) {
     // SDSIO-Client not initialized.
     return SDS_ERROR_IO;
   }
 
-  if ((id != NULL) && (buf != NULL) && (buf_size != 0U)) {
-    ret = sdsioLock();
+  if ((vec != NULL) && (vec_cnt != 0U)) {
+    // Get number of bytes to read.
+    for (n = 0U; n < vec_cnt; n++) {
+      if ((vec[n].buf == NULL) && (vec[n].buf_size != 0U)) {
+        break;
+      }
+      buf_size += vec[n].buf_size;
+    }
+    if (n != vec_cnt) {
+      // Invalid buffer.
+      buf_size = 0U;
+    }
+  }
+
+  if ((id != NULL) && (buf_size != 0U)) {
+#if (SDSIO_CLIENT_READ_STREAMING != 0)
+    ret = sdsioRxLock(SDSIO_CLIENT_LOCK_TIMEOUT);
     if (ret == SDS_OK) {
-      header.command   = SDSIO_CMD_READ;
-      header.sdsio_id  = (uint32_t)id;
-      header.argument  = buf_size;
-      header.data_size = 0U;
+      stream = sdsioClientStream((uint32_t)(uintptr_t)id);
+      if (stream != NULL) {
+        // Stream in streaming read mode.
+        ret = sdsioReadStream(stream, vec, vec_cnt);
+      }
+      sdsioClientRxRelease();
+      if (stream != NULL) {
+        return ret;
+      }
+    }
+#endif
+    header.command   = SDSIO_CMD_READ;
+    header.tag       = 0U;
+    header.sdsio_id  = (uint32_t)(uintptr_t)id;
+    header.argument  = buf_size;
+    header.data_size = 0U;
 
-      // Send header.
-      ret = sdsioClientSend((const uint8_t *)&header, sizeof(header));
-      if (ret == sizeof(header)) {
-        // Receive header
-        ret = sdsioClientReceiveHeader((uint8_t *)&header, sizeof(header));
-        // Check if full header is received.
-        if (ret == sizeof(header)) {
-          // Check if header is valid.
-          if ((header.command == SDSIO_CMD_READ) && (header.sdsio_id == (uint32_t)id)) {
-            if (header.data_size == 0) {
-              if (header.argument != 0U) {
-                // End of stream.
-                ret = SDS_EOS;
-              } else {
-                // No data available.
-                ret = 0;
-              }
-            } else {
-              if (header.data_size < buf_size) {
-                size = header.data_size;
-              } else {
-                size = buf_size;
-              }
-              // Read data.
-              ret = sdsioClientReceive((uint8_t *)buf, size, sdsioReceiveBlocking);
-            }
+    // Send command and receive response with data distributed to buffers.
+    ret = sdsioClientTransfer(&header, NULL, vec, vec_cnt);
+    if (ret >= 0) {
+      // Check if header is valid.
+      if ((header.command == SDSIO_CMD_READ) && (header.sdsio_id == (uint32_t)(uintptr_t)id)) {
+        if (header.data_size == 0U) {
+          if (header.argument != 0U) {
+            // End of stream.
+            ret = SDS_EOS;
           } else {
-            // Invalid header received.
-            ret = SDS_ERROR_IO;
+            // No data available.
+            ret = 0;
           }
-        } else if (ret >= 0) {
-          // Incomplete header received.
-          ret = SDS_ERROR_IO;
         }
-      } else if (ret >= 0) {
-        // Incomplete header sent.
+      } else {
+        // Invalid header received.
+        ret = SDS_ERROR_IO;
+      }
+    }
+  } else {
+    // Invalid parameter.
+    ret = SDS_ERROR_PARAMETER;
+  }
+
+  return ret;
+}
+
+/**
+  Reposition SDSIO stream opened in read mode to the first record at or after a timeslot.
+  Send:
+    header: command   = SDSIO_CMD_SEEK
+            tag       = request tag
+            sdsio_id  = sdsio identifier
+            argument  = timeslot
+            data_size = 0
+    data:   no data
+  Receive:
+    header: command   = SDSIO_CMD_SEEK
+            tag       = request tag
+            sdsio_id  = sdsio identifier
+            argument  = 0 = success, nonzero = seek failed
+            data_size = 0
+    data:   no data
+  Requires seek support of SDSIO-Server (SDSIO_FEATURE_SEEK).
+*/
+int32_t sdsioSeek (sdsioId_t id, uint32_t timeslot) {
+  int32_t        ret = SDS_ERROR_IO;
+  sdsio_header_t header;
+
+  if (sdsio_client_initialized == 0U) {
+    // SDSIO-Client not initialized.
+    return SDS_ERROR_IO;
+  }
+
+  if (!SDSIO_SERVER_FEATURE(SDSIO_FEATURE_SEEK)) {
+    // SDSIO-Server does not support seek.
+    return SDS_ERROR_IO;
+  }
+
+  if (id != NULL) {
+    header.command   = SDSIO_CMD_SEEK;
+    header.tag       = 0U;
+    header.sdsio_id  = (uint32_t)(uintptr_t)id;
+    header.argument  = timeslot;
+    header.data_size = 0U;
+
+    // Send command and receive response.
+    // In streaming read mode, data pushed from the previous position is discarded when the response is dispatched.
+    ret = sdsioClientTransfer(&header, NULL, NULL, 0U);
+    if (ret >= 0) {
+      if ((header.command   == SDSIO_CMD_SEEK)          &&
+          (header.sdsio_id  == (uint32_t)(uintptr_t)id) &&
+          (header.data_size == 0U)) {
+        ret = (header.argument == 0U) ? SDS_OK : SDS_ERROR;
+      } else {
+        // Invalid header received.
         ret = SDS_ERROR_IO;
       }
-      sdsioUnlock();
     }
   } else {
     // Invalid parameter.
@@ -427,6 +1752,55 @@ int32_t sdsioRead (sdsioId_t id, void *buf, uint32_t buf_size) {
   return ret;
 }
 
+/**
+  Send statistics of all open SDS streams to the host.
+  Send:
+    header: command   = SDSIO_CMD_STATS
+            sdsio_id  = sdsio identifier
+            argument  = not used
+            data_size = size of statistics (sdsStats_t)
+    data:   statistics
+  Statistics are sent only when supported by SDSIO-Server (SDSIO_FEATURE_STATS).
+*/
+static int32_t sdsioSendStats (void) {
+  int32_t        ret = SDS_OK;
+  int32_t        ret_io;
+  uint32_t       index;
+  void          *sdsio_id;
+  sdsStats_t     stats;
+  sdsioVec_t     vec;
+  sdsio_header_t header;
+
+  if (!SDSIO_SERVER_FEATURE(SDSIO_FEATURE_STATS)) {
+    return SDS_OK;
+  }
+
+  for (index = 0U; ret == SDS_OK; index++) {
+    ret_io = sdsGetStatsByIndex(index, &sdsio_id, &stats);
+    if (ret_io == SDS_ERROR_PARAMETER) {
+      // All streams processed.
+      break;
+    }
+    if (ret_io != SDS_OK) {
+      // Stream is not open.
+      continue;
+    }
+
+    header.command   = SDSIO_CMD_STATS;
+    header.tag       = 0U;
+    header.sdsio_id  = (uint32_t)(uintptr_t)sdsio_id;
+    header.argument  = 0U;
+    header.data_size = sizeof(sdsStats_t);
+
+    // Send header and data.
+    vec.buf      = &stats;
+    vec.buf_size = sizeof(sdsStats_t);
+    ret = sdsioClientSendFrame(&header, &vec, 1U);
+  }
+
+  return ret;
+}
+
 /**
   Check whether asynchronous SDSIO_CMD_FLAGS information has been received
   from the host, and update sdsFlags accordingly.
@@ -435,6 +1809,8 @@ int32_t sdsioRead (sdsioId_t id, void *buf, uint32_t buf_size) {
             sdsio_id  = set mask
             argument  = clear mask
             data_size = 0
+  Data pushed by the host to streams in streaming read mode (SDSIO_CMD_CREDIT)
+  is received as well (see sdsioReadv).
 
   Send the current sdsFlags value, along with sdsIdleRate and any optional
   error information (sdsError), to the host.
@@ -444,13 +1820,15 @@ int32_t sdsioRead (sdsioId_t id, void *buf, uint32_t buf_size) {
             argument  = sdsIdleRate
             data_size = number of error data bytes to send
     data:   error data to be sent
+
+  Send statistics of open SDS streams every SDSIO_CLIENT_STATS_INTERVAL calls
+  (see sdsioSendStats).
 */
 int32_t sdsExchange (void) {
   int32_t        ret, ret_io;
-  uint32_t       set_mask;
-  uint32_t       clr_mask;
   uint32_t       ofs = 0U;
   uint32_t       len = 0U;
+  sdsioVec_t     vec;
   sdsio_header_t header;
 
   if (sdsio_client_initialized == 0U) {
@@ -473,30 +1851,18 @@ int32_t sdsExchange (void) {
     }
   }
 
-  do {
-    // Check if asynchronous response with ID = 6 (SDSIO_CMD_FLAGS) was received
-    // and if it was then repeat to drain asynchronous responses if there are multiple
-    ret_io = sdsioClientReceive((uint8_t *)&header, sizeof(header), sdsioReceiveNonBlocking);
-    if (ret_io == sizeof(header)) {
-      // Process the flags response
-      if ((header.command == SDSIO_CMD_FLAGS) && (header.data_size == 0U)) {
-        set_mask = header.sdsio_id;
-        clr_mask = header.argument;
-        sdsFlagsModify(set_mask, clr_mask);
-        sdsio_client_inactive_rx_cnt = 0U;
-      } else {
-        // Invalid header received.
-        ret = SDS_ERROR_IO;
-      }
-    } else if (ret_io > 0) {
-      // Incomplete header received.
-      ret = SDS_ERROR_IO;
-    }
-  } while (ret_io == sizeof(header));
+  // Check if asynchronous responses with ID = 6 (SDSIO_CMD_FLAGS) or ID = 10 (SDSIO_CMD_CREDIT) were received
+  // and process them (drain asynchronous responses if there are multiple).
+  // When another thread is receiving from SDSIO-Server, it processes the asynchronous responses.
+  if (sdsioRxLock(0U) == SDS_OK) {
+    ret = sdsioClientDispatch(sdsioReceiveNonBlocking);
+    sdsioClientRxRelease();
+  }
 
   if ((ret == SDS_OK) && ((sdsFlags & SDS_FLAG_ALIVE) != 0U)) { // Send info only if Server is alive
     // Prepare and send Command with ID = 7 (SDSIO_CMD_INFO)
     header.command   = SDSIO_CMD_INFO;
+    header.tag       = 0U;
     header.sdsio_id  = sdsFlags;
     header.argument  = sdsIdleRate;
     header.data_size = 0U;
@@ -513,20 +1879,22 @@ int32_t sdsExchange (void) {
       header.data_size = ofs;
     }
   
-    // Send header.
-    ret_io = sdsioClientSend((const uint8_t *)&header, sizeof(header));
-    if (ret_io == sizeof(header)) {
-      if (header.data_size != 0U) {
-        // Send data.
-        ret_io = sdsioClientSend((const uint8_t *)sdsio_client_error_data, header.data_size);
-        if ((ret_io >= 0) && (ret_io < (int32_t)header.data_size)) {
-          // Incomplete data sent.
-          ret = SDS_ERROR_IO;
-        }
+    // Send header and data.
+    vec.buf      = sdsio_client_error_data;
+    vec.buf_size = header.data_size;
+    ret_io = sdsioClientSendFrame(&header, &vec, 1U);
+    if ((ret_io != SDS_OK) && (ret_io != SDS_ERROR_TIMEOUT)) {
+      // Incomplete header or data sent.
+      ret = ret_io;
+    }
+
+    if (ret == SDS_OK) {
+      // Send stream statistics periodically.
+      sdsio_client_stats_cnt++;
+      if (sdsio_client_stats_cnt >= SDSIO_CLIENT_STATS_INTERVAL) {
+        sdsio_client_stats_cnt = 0U;
+        ret = sdsioSendStats();
       }
-    } else if (ret_io >= 0) {
-      // Incomplete header sent.
-      ret = SDS_ERROR_IO;
     }
   }
 
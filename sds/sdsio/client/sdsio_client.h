@@ -26,6 +26,8 @@ extern "C"
 
 #include <stdint.h>
 
+#include "sdsio.h"
+
 // Receive mode
 typedef enum {
   sdsioReceiveBlocking    = 0U,         // Receive in blocking mode
@@ -63,6 +65,20 @@ int32_t sdsioClientUninit (void);
 */
 int32_t sdsioClientSend (const uint8_t *buf, uint32_t buf_size);
 
+/**
+  \fn          int32_t sdsioClientSendv (const sdsioVec_t *vec, uint32_t vec_cnt)
+  \brief       Send data from multiple buffers to SDSIO-Server (gather, blocking).
+               Used by SDSIO-Client for every command: the command header and data are passed in one call,
+               so that a transport can send them in a single transfer.
+               Optional: SDSIO-Client provides a default (weak) based on sdsioClientSend, which copies small
+               buffers (such as the header) to a staging buffer and sends large buffers directly.
+  \param[in]   vec         pointer to array of \ref sdsioVec_t buffers with data to send
+  \param[in]   vec_cnt     number of buffers in array
+  \return      number of bytes successfully sent or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsioClientSendv (const sdsioVec_t *vec, uint32_t vec_cnt);
+
 /**
   \fn          int32_t sdsioClientReceive (uint8_t *buf, uint32_t buf_size, sdsioReceiveMode_t mode)
   \brief       Receive data from SDSIO-Server in blocking or non-blocking mode.
@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// SDSIO payload codec
+
+#include <string.h>
+
+#include "sds.h"
+#include "sdsio_codec.h"
+
+// Record data byte is processed: next record header follows at the end of the record data.
+static void sdsioCodecData (sdsioCodecState_t *state) {
+
+  if (--state->rec_left == 0U) {
+    state->head_cnt = 0U;
+    state->ch       = 0U;
+  }
+}
+
+// Record header byte is processed: collects the data size of the record.
+static void sdsioCodecHead (sdsioCodecState_t *state, uint8_t byte) {
+
+  if (state->head_cnt >= 4U) {
+    // Data size (little-endian 32-bit, after the timeslot).
+    state->rec_left |= (uint32_t)byte << (8U * (state->head_cnt - 4U));
+  }
+  state->head_cnt++;
+  if ((state->head_cnt == SDSIO_CODEC_HEAD_SIZE) && (state->rec_left == 0U)) {
+    // Record without data.
+    state->head_cnt = 0U;
+  }
+}
+
+// Previous sample of the channel is replaced by the sample.
+static void sdsioCodecSample (sdsioCodecState_t *state, uint32_t sample) {
+
+  state->prev[state->ch] = (uint16_t)sample;
+  if (++state->ch == state->channels) {
+    state->ch = 0U;
+  }
+}
+
+/**
+  Initialize the codec state of a stream.
+*/
+void sdsioCodecInit (sdsioCodecState_t *state, uint32_t codec) {
+
+  memset(state, 0, sizeof(sdsioCodecState_t));
+  state->codec    = codec;
+  state->channels = (uint8_t)(((codec >> 4) & 0x0FU) + 1U);
+}
+
+/**
+  Encode stream data with a payload codec.
+*/
+uint32_t sdsioCodecEncode (sdsioCodecState_t *state, const uint8_t *in, uint32_t *in_size, uint8_t *out, uint32_t out_size) {
+  uint32_t num = 0U;
+  uint32_t n   = 0U;
+  uint32_t sample, zz;
+  uint8_t  byte;
+
+  if ((state->codec & SDSIO_CODEC_TYPE_Msk) != SDSIO_CODEC_TYPE_DELTA16) {
+    // Unsupported codec.
+    *in_size = 0U;
+    return 0U;
+  }
+
+  while ((n < *in_size) && ((out == NULL) || ((out_size - num) >= SDSIO_CODEC_DELTA16_MAX))) {
+    byte = in[n++];
+
+    if (state->head_cnt < SDSIO_CODEC_HEAD_SIZE) {
+      // Record header: copied.
+      sdsioCodecHead(state, byte);
+      if (out != NULL) {
+        out[num] = byte;
+      }
+      num++;
+      continue;
+    }
+
+    if (state->odd == 0U) {
+      if (state->rec_left == 1U) {
+        // Trailing odd byte of the record data: copied.
+        if (out != NULL) {
+          out[num] = byte;
+        }
+        num++;
+      } else {
+        // Low byte of the sample (may be split from the high byte by the end of the buffer).
+        state->low = byte;
+        state->odd = 1U;
+      }
+      sdsioCodecData(state);
+      continue;
+    }
+
+    sample = (uint32_t)state->low | ((uint32_t)byte << 8);
+    if (state->odd == 2U) {
+      // Low byte has been copied at the end of the previous command: high byte is copied.
+      if (out != NULL) {
+        out[num] = byte;
+      }
+      num++;
+    } else {
+      // Difference to previous sample of the channel (16-bit), zigzag coded: small magnitudes give small values.
+      zz = (sample - state->prev[state->ch]) & 0xFFFFU;
+      zz = ((zz << 1) ^ (((zz & 0x8000U) != 0U) ? 0xFFFFU : 0U)) & 0xFFFFU;
+
+      // LEB128 varint: 7 bits per byte, bit 7 set when more bytes follow.
+      if (zz < 0x80U) {
+        if (out != NULL) {
+          out[num] = (uint8_t)zz;
+        }
+        num += 1U;
+      } else if (zz < 0x4000U) {
+        if (out != NULL) {
+          out[num]      = (uint8_t)(zz | 0x80U);
+          out[num + 1U] = (uint8_t)(zz >> 7);
+        }
+        num += 2U;
+      } else {
+        if (out != NULL) {
+          out[num]      = (uint8_t)(zz | 0x80U);
+          out[num + 1U] = (uint8_t)((zz >> 7) | 0x80U);
+          out[num + 2U] = (uint8_t)(zz >> 14);
+        }
+        num += 3U;
+      }
+    }
+    state->odd = 0U;
+    sdsioCodecSample(state, sample);
+    sdsioCodecData(state);
+  }
+
+  *in_size = n;
+
+  return num;
+}
+
+/**
+  End the encoded data of a command.
+*/
+uint32_t sdsioCodecEncodeEnd (sdsioCodecState_t *state, uint8_t *out) {
+
+  if (state->odd != 1U) {
+    return 0U;
+  }
+
+  // Sample is split between commands: low byte is copied (the high byte in the next command as well).
+  if (out != NULL) {
+    out[0] = state->low;
+  }
+  state->odd = 2U;
+
+  return 1U;
+}
+
+/**
+  Decode the data of a command encoded with sdsioCodecEncode and sdsioCodecEncodeEnd.
+*/
+int32_t sdsioCodecDecode (sdsioCodecState_t *state, const uint8_t *in, uint32_t in_size, uint8_t *out, uint32_t out_size) {
+  uint32_t num = 0U;
+  uint32_t pos = 0U;
+  uint32_t shift, sample, zz;
+
+  if ((state->codec & SDSIO_CODEC_TYPE_Msk) != SDSIO_CODEC_TYPE_DELTA16) {
+    // Unsupported codec.
+    return SDS_ERROR_PARAMETER;
+  }
+
+  while (pos < out_size) {
+    if (num == in_size) {
+      // Truncated data.
+      return SDS_ERROR;
+    }
+
+    if (state->head_cnt < SDSIO_CODEC_HEAD_SIZE) {
+      // Record header: copied.
+      sdsioCodecHead(state, in[num]);
+      out[pos++] = in[num++];
+      continue;
+    }
+
+    if (state->odd == 2U) {
+      // High byte of the sample split between commands: copied.
+      sample = (uint32_t)state->low | ((uint32_t)in[num] << 8);
+      out[pos++] = in[num++];
+      state->odd = 0U;
+      sdsioCodecSample(state, sample);
+      sdsioCodecData(state);
+      continue;
+    }
+
+    if ((state->rec_left == 1U) || ((out_size - pos) == 1U)) {
+      // Trailing odd byte of the record data or low byte of the sample split between commands: copied.
+      if (state->rec_left != 1U) {
+        state->low = in[num];
+        state->odd = 2U;
+      }
+      out[pos++] = in[num++];
+      sdsioCodecData(state);
+      continue;
+    }
+
+    zz    = 0U;
+    shift = 0U;
+    do {
+      if ((num == in_size) || (shift > 14U)) {
+        // Truncated or invalid data.
+        return SDS_ERROR;
+      }
+      zz    |= (uint32_t)(in[num] & 0x7FU) << shift;
+      shift += 7U;
+    } while ((in[num++] & 0x80U) != 0U);
+
+    sample = (state->prev[state->ch] + ((zz >> 1) ^ (((zz & 1U) != 0U) ? 0xFFFFU : 0U))) & 0xFFFFU;
+    sdsioCodecSample(state, sample);
+    out[pos++] = (uint8_t)sample;
+    out[pos++] = (uint8_t)(sample >> 8);
+    sdsioCodecData(state);
+    sdsioCodecData(state);
+  }
+
+  if (num != in_size) {
+    // Data left over.
+    return SDS_ERROR;
+  }
+
+  return (int32_t)out_size;
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SDSIO_CODEC_H
+#define SDSIO_CODEC_H
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+// Codec identifier (8-bit, see SDSIO_CODEC_xxx in sdsio.h shifted down by SDSIO_CODEC_Pos)
+//  bits 0..3: codec type
+//  bits 4..7: codec parameter (SDSIO_CODEC_TYPE_DELTA16: number of interleaved channels - 1)
+#define SDSIO_CODEC_TYPE_Msk            0x0FU
+#define SDSIO_CODEC_TYPE_NONE           0x00U   // Data is not encoded
+#define SDSIO_CODEC_TYPE_DELTA16        0x01U   // Delta-varint coding of 16-bit little-endian samples
+
+// Maximum size of encoded data per 16-bit sample in bytes (SDSIO_CODEC_TYPE_DELTA16)
+#define SDSIO_CODEC_DELTA16_MAX         3U
+
+// Maximum number of interleaved channels (SDSIO_CODEC_TYPE_DELTA16)
+#define SDSIO_CODEC_CHANNELS_MAX        16U
+
+// Size of the SDS record header (timeslot, data size) in the stream data
+#define SDSIO_CODEC_HEAD_SIZE           8U
+
+// Codec state of a stream (carried across buffers and commands, same on encoder and decoder side)
+typedef struct {
+  uint32_t codec;                       // Codec identifier
+  uint32_t rec_left;                    // Number of record data bytes not processed yet
+  uint16_t prev[SDSIO_CODEC_CHANNELS_MAX]; // Previous sample of each channel
+  uint8_t  channels;                    // Number of interleaved channels
+  uint8_t  ch;                          // Channel of the next sample
+  uint8_t  head_cnt;                    // Number of record header bytes processed (SDSIO_CODEC_HEAD_SIZE = record data)
+  uint8_t  odd;                         // Low byte of a sample: 0 = none, 1 = pending, 2 = copied at end of command
+  uint8_t  low;                         // Low byte of a sample
+  uint8_t  reserved[3];
+} sdsioCodecState_t;
+
+/**
+  \fn          void sdsioCodecInit (sdsioCodecState_t *state, uint32_t codec)
+  \brief       Initialize the codec state of a stream (at stream open, on encoder and decoder side).
+  \param[out]  state        pointer to codec state
+  \param[in]   codec        codec identifier
+*/
+void sdsioCodecInit (sdsioCodecState_t *state, uint32_t codec);
+
+/**
+  \fn          uint32_t sdsioCodecEncode (sdsioCodecState_t *state, const uint8_t *in, uint32_t *in_size, uint8_t *out, uint32_t out_size)
+  \brief       Encode stream data with a payload codec.
+               Data is encoded until the input is consumed or the output buffer is full; the state is carried
+               to the next call, so data of a command can be passed in any number of buffers.
+               SDSIO_CODEC_TYPE_DELTA16: the stream data consists of SDS records. Record headers are copied.
+               In the record data each 16-bit sample is replaced by the difference to the previous sample
+               of the same channel (zigzag, LEB128 varint: 1 to 3 bytes), the channels start with channel 0
+               in each record. A trailing odd byte of the record data is copied.
+  \param[in,out] state      pointer to codec state
+  \param[in]   in           pointer to data to encode
+  \param[in,out] in_size    size of data to encode in bytes, replaced by the number of bytes consumed
+  \param[out]  out          pointer to buffer for encoded data
+                            (NULL: all data is consumed and only the encoded size is returned)
+  \param[in]   out_size     size of output buffer in bytes
+  \return      size of encoded data in bytes (0 for unsupported codec)
+*/
+uint32_t sdsioCodecEncode (sdsioCodecState_t *state, const uint8_t *in, uint32_t *in_size, uint8_t *out, uint32_t out_size);
+
+/**
+  \fn          uint32_t sdsioCodecEncodeEnd (sdsioCodecState_t *state, uint8_t *out)
+  \brief       End the encoded data of a command.
+               The low byte of a sample which is split between commands is copied (at most 1 byte).
+               Data of a command which is sent as is updates the state with sdsioCodecEncode (out = NULL)
+               and sdsioCodecEncodeEnd on both sides.
+  \param[in,out] state      pointer to codec state
+  \param[out]  out          pointer to buffer for encoded data (NULL: only the size is returned)
+  \return      size of encoded data in bytes
+*/
+uint32_t sdsioCodecEncodeEnd (sdsioCodecState_t *state, uint8_t *out);
+
+/**
+  \fn          int32_t sdsioCodecDecode (sdsioCodecState_t *state, const uint8_t *in, uint32_t in_size, uint8_t *out, uint32_t out_size)
+  \brief       Decode the data of a command encoded with sdsioCodecEncode and sdsioCodecEncodeEnd.
+  \param[in,out] state      pointer to codec state
+  \param[in]   in           pointer to encoded data
+  \param[in]   in_size      size of encoded data in bytes
+  \param[out]  out          pointer to buffer for decoded data
+  \param[in]   out_size     size of decoded data in bytes (as consumed by sdsioCodecEncode)
+  \return      size of decoded data in bytes or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsioCodecDecode (sdsioCodecState_t *state, const uint8_t *in, uint32_t in_size, uint8_t *out, uint32_t out_size);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* SDSIO_CODEC_H */
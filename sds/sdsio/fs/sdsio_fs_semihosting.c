@@ -37,7 +37,7 @@
 
 // Buffer for file name construction (shared to avoid stack usage in sdsioOpen)
 static char file_name[SDSIO_MAX_NAME_SIZE + SDSIO_MAX_EXT_SIZE];
-static char bak_name [SDSIO_MAX_NAME_SIZE + SDSIO_MAX_EXT_SIZE];
+static char bak_name [sizeof(file_name) + 4U];       // file name with .bak extension
 
 // Playback mode flag
 static uint32_t sdsio_playback_flag = 0U;
@@ -137,6 +137,9 @@ sdsioId_t sdsioOpen (const char *name, sdsioMode_t mode) {
     return NULL;
   }
 
+  // Payload codec is not used with file system.
+  mode = (sdsioMode_t)((uint32_t)mode & SDSIO_MODE_Msk);
+
   if (strlen(name) > SDSIO_MAX_NAME_SIZE) {
     SDS_PRINTF("SDSIO: Stream name '%s' is too long (max %i characters)\n", name, SDSIO_MAX_NAME_SIZE);
     return NULL;
@@ -211,7 +214,7 @@ sdsioId_t sdsioOpen (const char *name, sdsioMode_t mode) {
         if (file != NULL) {
           // File exists: back up existing file before overwriting
           fclose(file);
-          sprintf(bak_name, "%s.bak", file_name);
+          snprintf(bak_name, sizeof(bak_name), "%s.bak", file_name);
           remove(bak_name);
           rename(file_name, bak_name);
         }
@@ -322,6 +325,144 @@ int32_t sdsioRead (sdsioId_t id, void *buf, uint32_t buf_size) {
   return ret;
 }
 
+/**
+  \fn          int32_t sdsioWritev (sdsioId_t id, const sdsioVec_t *vec, uint32_t vec_cnt)
+  \brief       Write data from multiple buffers to SDSIO stream (gather).
+  \param[in]   id             \ref sdsioId_t handle to SDSIO stream
+  \param[in]   vec            pointer to array of \ref sdsioVec_t buffers with data to write
+  \param[in]   vec_cnt        number of buffers in array
+  \return      number of bytes successfully written or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsioWritev (sdsioId_t id, const sdsioVec_t *vec, uint32_t vec_cnt) {
+  int32_t  ret = SDS_ERROR_PARAMETER;
+  uint32_t cnt = 0U;
+  uint32_t n;
+
+  if ((id == NULL) || (vec == NULL)) {
+    return SDS_ERROR_PARAMETER;
+  }
+
+  for (n = 0U; n < vec_cnt; n++) {
+    if (vec[n].buf_size == 0U) {
+      continue;
+    }
+    ret = sdsioWrite(id, vec[n].buf, vec[n].buf_size);
+    if (ret < 0) {
+      break;
+    }
+    cnt += (uint32_t)ret;
+    if (ret < (int32_t)vec[n].buf_size) {
+      // Partial write.
+      break;
+    }
+  }
+  if (ret >= 0) {
+    ret = (int32_t)cnt;
+  }
+
+  return ret;
+}
+
+/**
+  \fn          int32_t sdsioReadv (sdsioId_t id, const sdsioVec_t *vec, uint32_t vec_cnt)
+  \brief       Read data from SDSIO stream into multiple buffers (scatter).
+  \param[in]   id             \ref sdsioId_t handle to SDSIO stream
+  \param[in]   vec            pointer to array of \ref sdsioVec_t buffers for data to read
+  \param[in]   vec_cnt        number of buffers in array
+  \return      number of bytes successfully read, or
+               a negative value on error or SDS_EOS (see \ref SDS_Return_Codes)
+*/
+int32_t sdsioReadv (sdsioId_t id, const sdsioVec_t *vec, uint32_t vec_cnt) {
+  int32_t  ret = SDS_ERROR_PARAMETER;
+  uint32_t cnt = 0U;
+  uint32_t n;
+
+  if ((id == NULL) || (vec == NULL)) {
+    return SDS_ERROR_PARAMETER;
+  }
+
+  for (n = 0U; n < vec_cnt; n++) {
+    if (vec[n].buf_size == 0U) {
+      continue;
+    }
+    ret = sdsioRead(id, vec[n].buf, vec[n].buf_size);
+    if (ret < 0) {
+      break;
+    }
+    cnt += (uint32_t)ret;
+    if (ret < (int32_t)vec[n].buf_size) {
+      // Partial read.
+      break;
+    }
+  }
+  if ((ret >= 0) || ((ret == SDS_EOS) && (cnt != 0U))) {
+    // Return number of bytes read (end of stream is reported on next read).
+    ret = (int32_t)cnt;
+  }
+
+  return ret;
+}
+
+/**
+  \fn          int32_t sdsioSeek (sdsioId_t id, uint32_t timeslot)
+  \brief       Reposition SDSIO stream opened in read mode to the first record at or after a timeslot.
+  \param[in]   id             \ref sdsioId_t handle to SDSIO stream
+  \param[in]   timeslot       timeslot to seek to
+  \return      SDS_OK on success or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsioSeek (sdsioId_t id, uint32_t timeslot) {
+  FILE    *file = (FILE *)id;
+  int32_t  ret  = SDS_OK;
+  uint32_t head[2];                     // Record header: timeslot, data size
+  long     pos;
+
+  if (file == NULL) {
+    return SDS_ERROR_PARAMETER;
+  }
+
+  // Walk the record headers from the start of the file, the data blocks are skipped.
+  if (fseek(file, 0L, SEEK_SET) != 0) {
+    return SDS_ERROR_IO;
+  }
+  while (1) {
+    pos = ftell(file);
+    if (fread(head, 1, sizeof(head), file) != sizeof(head)) {
+      // No record at or after the timeslot: stream is positioned at the end.
+      if (ferror(file) != 0) {
+        ret = SDS_ERROR_IO;
+      }
+      break;
+    }
+    if (head[0] >= timeslot) {
+      // Position to the header of the first record at or after the timeslot.
+      if (fseek(file, pos, SEEK_SET) != 0) {
+        ret = SDS_ERROR_IO;
+      }
+      break;
+    }
+    if (fseek(file, (long)head[1], SEEK_CUR) != 0) {
+      ret = SDS_ERROR_IO;
+      break;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  \fn          uint32_t sdsioGetTransferSize (void)
+  \brief       Get efficient transfer size of SDSIO interface.
+  \return      transfer size in bytes or
+               0 when not specified (SDS uses SDS_IO_TRANSFER_SIZE)
+*/
+uint32_t sdsioGetTransferSize (void) {
+
+  // Transfer size is specified by SDS_IO_TRANSFER_SIZE.
+  return 0U;
+}
+
 /**
   Exchange information with the host.
 */
@@ -36,6 +36,28 @@ typedef enum {
   sdsioModeWrite = 1            // Open for write (binary)
 } sdsioMode_t;                  // Open mode (read/write)
 
+// Payload codec of a write stream: OR-ed with sdsioModeWrite in sdsioOpen
+//  Applied by SDSIO-Client when supported by SDSIO-Server (ignored by other SDSIO interfaces).
+#define SDSIO_MODE_Msk          (0xFFU)
+#define SDSIO_CODEC_Pos         8U
+#define SDSIO_CODEC_Msk         (0xFFU << SDSIO_CODEC_Pos)
+#define SDSIO_CODEC_NONE        (0x00U << SDSIO_CODEC_Pos)  // Data is not encoded
+#define SDSIO_CODEC_DELTA16(ch) ((0x01U | ((((ch) - 1U) & 0x0FU) << 4)) << SDSIO_CODEC_Pos)
+                                // Delta-varint coding of 16-bit samples with ch (1..16) interleaved channels
+
+// Open parameters of a SDSIO stream in a group
+typedef struct {
+  const char  *name;            // Stream name (pointer to NULL terminated string)
+  sdsioMode_t  mode;            // Open mode (write mode: optionally OR-ed with SDSIO_CODEC_xxx)
+  sdsioId_t    id;              // Handle to SDSIO stream, or NULL if open failed (set by sdsioOpenGroup)
+} sdsioOpenParam_t;
+
+// I/O Vector
+typedef struct {
+  void     *buf;                // Pointer to data buffer
+  uint32_t  buf_size;           // Buffer size in bytes
+} sdsioVec_t;                   // Data buffer segment for vectored read/write
+
 /**
   \fn          int32_t sdsioInit (void)
   \brief       Initialize SDSIO interface.
@@ -56,11 +78,22 @@ int32_t sdsioUninit (void);
   \fn          sdsioId_t sdsioOpen (const char *name, sdsioMode_t mode)
   \brief       Open SDSIO stream.
   \param[in]   name           stream name (pointer to NULL terminated string)
-  \param[in]   mode           \ref sdsioMode_t open mode
+  \param[in]   mode           \ref sdsioMode_t open mode (write mode: optionally OR-ed with SDSIO_CODEC_xxx)
   \return      \ref sdsioId_t Handle to SDSIO stream, or NULL if operation failed
 */
 sdsioId_t sdsioOpen (const char *name, sdsioMode_t mode);
 
+/**
+  \fn          int32_t sdsioOpenGroup (sdsioOpenParam_t *param, uint32_t cnt)
+  \brief       Open a group of SDSIO streams.
+               Optional: the default implementation (sdsio_default.c) opens the streams one after another with sdsioOpen.
+  \param[in,out] param        pointer to array of \ref sdsioOpenParam_t open parameters (receives the handles)
+  \param[in]   cnt            number of streams in the group
+  \return      SDS_OK when all streams are opened or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsioOpenGroup (sdsioOpenParam_t *param, uint32_t cnt);
+
 /**
   \fn          int32_t sdsioClose (sdsioId_t id)
   \brief       Close SDSIO stream.
@@ -92,6 +125,50 @@ int32_t sdsioWrite (sdsioId_t id, const void *buf, uint32_t buf_size);
 */
 int32_t sdsioRead (sdsioId_t id, void *buf, uint32_t buf_size);
 
+/**
+  \fn          int32_t sdsioWritev (sdsioId_t id, const sdsioVec_t *vec, uint32_t vec_cnt)
+  \brief       Write data from multiple buffers to SDSIO stream (gather).
+               Optional: the default implementation (sdsio_default.c) calls sdsioWrite for each buffer.
+  \param[in]   id             \ref sdsioId_t handle to SDSIO stream
+  \param[in]   vec            pointer to array of \ref sdsioVec_t buffers with data to write
+  \param[in]   vec_cnt        number of buffers in array
+  \return      number of bytes successfully written or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsioWritev (sdsioId_t id, const sdsioVec_t *vec, uint32_t vec_cnt);
+
+/**
+  \fn          int32_t sdsioReadv (sdsioId_t id, const sdsioVec_t *vec, uint32_t vec_cnt)
+  \brief       Read data from SDSIO stream into multiple buffers (scatter).
+               Optional: the default implementation (sdsio_default.c) calls sdsioRead for each buffer.
+  \param[in]   id             \ref sdsioId_t handle to SDSIO stream
+  \param[in]   vec            pointer to array of \ref sdsioVec_t buffers for data to read
+  \param[in]   vec_cnt        number of buffers in array
+  \return      number of bytes successfully read, or
+               a negative value on error or SDS_EOS (see \ref SDS_Return_Codes)
+*/
+int32_t sdsioReadv (sdsioId_t id, const sdsioVec_t *vec, uint32_t vec_cnt);
+
+/**
+  \fn          int32_t sdsioSeek (sdsioId_t id, uint32_t timeslot)
+  \brief       Reposition SDSIO stream opened in read mode to the first record at or after a timeslot.
+               Optional: the default implementation (sdsio_default.c) returns SDS_ERROR (not supported).
+  \param[in]   id             \ref sdsioId_t handle to SDSIO stream
+  \param[in]   timeslot       timeslot to seek to
+  \return      SDS_OK on success or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsioSeek (sdsioId_t id, uint32_t timeslot);
+
+/**
+  \fn          uint32_t sdsioGetTransferSize (void)
+  \brief       Get efficient transfer size of SDSIO interface.
+               Optional: the default implementation (sdsio_default.c) returns 0.
+  \return      transfer size in bytes or
+               0 when not specified (SDS uses SDS_IO_TRANSFER_SIZE)
+*/
+uint32_t sdsioGetTransferSize (void);
+
 #ifdef  __cplusplus
 }
 #endif
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// SDSIO default implementations of optional SDSIO interface functions
+//  Weak functions used with SDSIO interfaces which implement only SDSIO Interface API 3.0.
+
+#include <stddef.h>
+
+#include "cmsis_compiler.h"
+
+#include "sds.h"
+#include "sdsio.h"
+
+
+/**
+  Open a group of SDSIO streams one after another.
+  Default for SDSIO interfaces which do not open streams concurrently.
+*/
+__WEAK int32_t sdsioOpenGroup (sdsioOpenParam_t *param, uint32_t cnt) {
+  int32_t  ret = SDS_OK;
+  uint32_t n;
+
+  for (n = 0U; n < cnt; n++) {
+    param[n].id = sdsioOpen(param[n].name, param[n].mode);
+    if (param[n].id == NULL) {
+      ret = SDS_ERROR;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  Write data from multiple buffers to SDSIO stream with one sdsioWrite per buffer.
+  Default for SDSIO interfaces without gather write.
+*/
+__WEAK int32_t sdsioWritev (sdsioId_t id, const sdsioVec_t *vec, uint32_t vec_cnt) {
+  uint32_t total = 0U;
+  uint32_t n;
+  int32_t  num;
+
+  for (n = 0U; n < vec_cnt; n++) {
+    if (vec[n].buf_size == 0U) {
+      continue;
+    }
+    num = sdsioWrite(id, vec[n].buf, vec[n].buf_size);
+    if (num < 0) {
+      // Error: return error only when no data has been written.
+      return (total != 0U) ? (int32_t)total : num;
+    }
+    total += (uint32_t)num;
+    if ((uint32_t)num < vec[n].buf_size) {
+      // Partial write: remaining buffers are not written.
+      break;
+    }
+  }
+
+  return (int32_t)total;
+}
+
+/**
+  Read data from SDSIO stream into multiple buffers with one sdsioRead per buffer.
+  Default for SDSIO interfaces without scatter read.
+*/
+__WEAK int32_t sdsioReadv (sdsioId_t id, const sdsioVec_t *vec, uint32_t vec_cnt) {
+  uint32_t total = 0U;
+  uint32_t n;
+  int32_t  num;
+
+  for (n = 0U; n < vec_cnt; n++) {
+    if (vec[n].buf_size == 0U) {
+      continue;
+    }
+    num = sdsioRead(id, vec[n].buf, vec[n].buf_size);
+    if (num < 0) {
+      // Error or end of stream: return it only when no data has been read.
+      return (total != 0U) ? (int32_t)total : num;
+    }
+    total += (uint32_t)num;
+    if ((uint32_t)num < vec[n].buf_size) {
+      // Partial read: remaining buffers are not filled.
+      break;
+    }
+  }
+
+  return (int32_t)total;
+}
+
+/**
+  Reposition SDSIO stream to a timeslot.
+  Default for SDSIO interfaces without seek support: not supported.
+*/
+__WEAK int32_t sdsioSeek (sdsioId_t id, uint32_t timeslot) {
+  (void)id;
+  (void)timeslot;
+
+  return SDS_ERROR;
+}
+
+/**
+  Get efficient transfer size of SDSIO interface.
+  Default for SDSIO interfaces without a preferred transfer size: not specified.
+*/
+__WEAK uint32_t sdsioGetTransferSize (void) {
+  return 0U;
+}
@@ -23,6 +23,7 @@
 #include <string.h>
 #include "cmsis_os2.h"
 #include "sds.h"
+#include "../../sds_internal.h"
 #include "sdsio.h"
 #include "arm_vsi.h"
 
@@ -42,13 +43,22 @@
 #define CMD_READ        4U
 #define CMD_FLAGS       6U
 #define CMD_INFO        7U
+#define CMD_STATS       8U
+#define CMD_SEEK        9U
 
 #ifndef SDSIO_VSI_ERROR_MAX_DATA_SIZE
 #define SDSIO_VSI_ERROR_MAX_DATA_SIZE  128U
 #endif
 
+// Stream statistics interval (number of sdsExchange calls between sending stream statistics)
+#ifndef SDSIO_VSI_STATS_INTERVAL
+#define SDSIO_VSI_STATS_INTERVAL       10U
+#endif
+
 static osSemaphoreId_t lock_id = NULL;
 static uint8_t         error_data[SDSIO_VSI_ERROR_MAX_DATA_SIZE];
+static uint32_t        stats_cnt = 0U;
+static sdsStats_t      stats;
 
 // SDSIO functions
 
@@ -121,7 +131,7 @@ sdsioId_t sdsioOpen (const char *name, sdsioMode_t mode) {
   while (SDSIO->Timer.Control & ARM_VSI_Timer_Run_Msk);
   SDSIO->DMA.Control = 0U;
 
-  SDSIO->ARGUMENT    = mode;
+  SDSIO->ARGUMENT    = (uint32_t)mode & SDSIO_MODE_Msk;   /* Payload codec is not used with VSI */
   SDSIO->COMMAND     = CMD_OPEN;
 
   id = (sdsioId_t)SDSIO->STREAM_ID;
@@ -248,6 +258,168 @@ int32_t sdsioRead (sdsioId_t id, void *buf, uint32_t buf_size) {
   return retv;
 }
 
+/**
+  \fn          int32_t sdsioWritev (sdsioId_t id, const sdsioVec_t *vec, uint32_t vec_cnt)
+  \brief       Write data from multiple buffers to SDSIO stream (gather).
+  \param[in]   id             \ref sdsioId_t handle to SDSIO stream
+  \param[in]   vec            pointer to array of \ref sdsioVec_t buffers with data to write
+  \param[in]   vec_cnt        number of buffers in array
+  \return      number of bytes successfully written or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsioWritev (sdsioId_t id, const sdsioVec_t *vec, uint32_t vec_cnt) {
+  int32_t  ret = SDS_ERROR_PARAMETER;
+  uint32_t cnt = 0U;
+  uint32_t n;
+
+  if ((id == NULL) || (vec == NULL)) {
+    return SDS_ERROR_PARAMETER;
+  }
+
+  for (n = 0U; n < vec_cnt; n++) {
+    if (vec[n].buf_size == 0U) {
+      continue;
+    }
+    ret = sdsioWrite(id, vec[n].buf, vec[n].buf_size);
+    if (ret < 0) {
+      break;
+    }
+    cnt += (uint32_t)ret;
+    if (ret < (int32_t)vec[n].buf_size) {
+      // Partial write.
+      break;
+    }
+  }
+  if (ret >= 0) {
+    ret = (int32_t)cnt;
+  }
+
+  return ret;
+}
+
+/**
+  \fn          int32_t sdsioReadv (sdsioId_t id, const sdsioVec_t *vec, uint32_t vec_cnt)
+  \brief       Read data from SDSIO stream into multiple buffers (scatter).
+  \param[in]   id             \ref sdsioId_t handle to SDSIO stream
+  \param[in]   vec            pointer to array of \ref sdsioVec_t buffers for data to read
+  \param[in]   vec_cnt        number of buffers in array
+  \return      number of bytes successfully read, or
+               a negative value on error or SDS_EOS (see \ref SDS_Return_Codes)
+*/
+int32_t sdsioReadv (sdsioId_t id, const sdsioVec_t *vec, uint32_t vec_cnt) {
+  int32_t  ret = SDS_ERROR_PARAMETER;
+  uint32_t cnt = 0U;
+  uint32_t n;
+
+  if ((id == NULL) || (vec == NULL)) {
+    return SDS_ERROR_PARAMETER;
+  }
+
+  for (n = 0U; n < vec_cnt; n++) {
+    if (vec[n].buf_size == 0U) {
+      continue;
+    }
+    ret = sdsioRead(id, vec[n].buf, vec[n].buf_size);
+    if (ret < 0) {
+      break;
+    }
+    cnt += (uint32_t)ret;
+    if (ret < (int32_t)vec[n].buf_size) {
+      // Partial read.
+      break;
+    }
+  }
+  if ((ret >= 0) || ((ret == SDS_EOS) && (cnt != 0U))) {
+    // Return number of bytes read (end of stream is reported on next read).
+    ret = (int32_t)cnt;
+  }
+
+  return ret;
+}
+
+/**
+  \fn          int32_t sdsioSeek (sdsioId_t id, uint32_t timeslot)
+  \brief       Reposition SDSIO stream opened in read mode to the first record at or after a timeslot.
+  \param[in]   id             \ref sdsioId_t handle to SDSIO stream
+  \param[in]   timeslot       timeslot to seek to
+  \return      SDS_OK on success or
+               a negative value on error (see \ref SDS_Return_Codes)
+*/
+int32_t sdsioSeek (sdsioId_t id, uint32_t timeslot) {
+  int32_t retv;
+
+  if (id == NULL) {
+    return SDS_ERROR_PARAMETER;
+  }
+
+  if (osSemaphoreAcquire (lock_id, osWaitForever) != osOK) {
+    return SDS_ERROR_IO;
+  }
+
+  SDSIO->STREAM_ID = (uint32_t)id;
+  SDSIO->ARGUMENT  = timeslot;
+  SDSIO->COMMAND   = CMD_SEEK;
+
+  /* Return seek status */
+  retv = (int32_t)SDSIO->ARGUMENT;
+
+  osSemaphoreRelease (lock_id);
+
+  return retv;
+}
+
+/**
+  \fn          uint32_t sdsioGetTransferSize (void)
+  \brief       Get efficient transfer size of SDSIO interface.
+  \return      transfer size in bytes or
+               0 when not specified (SDS uses SDS_IO_TRANSFER_SIZE)
+*/
+uint32_t sdsioGetTransferSize (void) {
+
+  /* Transfer size is specified by SDS_IO_TRANSFER_SIZE */
+  return 0U;
+}
+
+/**
+  Send statistics of all open SDS streams to the host.
+  Send:
+    header: command   = SDSIO_CMD_STATS
+            sdsio_id  = sdsio identifier
+            argument  = size of statistics (sdsStats_t)
+    data:   statistics
+*/
+static void sdsioSendStats (void) {
+  uint32_t index;
+  void    *sdsio_id;
+  int32_t  ret;
+
+  for (index = 0U; ; index++) {
+    ret = sdsGetStatsByIndex(index, &sdsio_id, &stats);
+    if (ret == SDS_ERROR_PARAMETER) {
+      /* All streams processed. */
+      break;
+    }
+    if (ret != SDS_OK) {
+      /* Stream is not open. */
+      continue;
+    }
+
+    SDSIO->DMA.Address    = (uint32_t)&stats;
+    SDSIO->DMA.BlockSize  = sizeof(sdsStats_t);
+    SDSIO->DMA.BlockNum   = 1U;
+    SDSIO->DMA.Control    = ARM_VSI_DMA_Direction_M2P  | ARM_VSI_DMA_Enable_Msk;
+    SDSIO->Timer.Interval = 0U;
+    SDSIO->Timer.Control  = ARM_VSI_Timer_Trig_DMA_Msk | ARM_VSI_Timer_Run_Msk;
+
+    while (SDSIO->Timer.Control & ARM_VSI_Timer_Run_Msk);
+    SDSIO->DMA.Control = 0U;
+
+    SDSIO->STREAM_ID = (uint32_t)sdsio_id;
+    SDSIO->ARGUMENT  = sizeof(sdsStats_t);
+    SDSIO->COMMAND   = CMD_STATS;
+  }
+}
+
 /**
   Check whether asynchronous SDSIO_CMD_FLAGS information has been received
   from the host, and update sdsFlags accordingly.
@@ -265,6 +437,9 @@ int32_t sdsioRead (sdsioId_t id, void *buf, uint32_t buf_size) {
             argument  = sdsIdleRate
             data_size = number of error data bytes to send
     data:   error data to be sent
+
+  Send statistics of open SDS streams every SDSIO_VSI_STATS_INTERVAL calls
+  (see sdsioSendStats).
 */
 int32_t sdsExchange (void) {
   uint32_t set_mask;
@@ -316,6 +491,13 @@ int32_t sdsExchange (void) {
     SDSIO->STREAM_ID = sdsFlags;
     SDSIO->ARGUMENT  = sdsIdleRate;
     SDSIO->COMMAND   = CMD_INFO;
+
+    /* Send stream statistics periodically. */
+    stats_cnt++;
+    if (stats_cnt >= SDSIO_VSI_STATS_INTERVAL) {
+      stats_cnt = 0U;
+      sdsioSendStats();
+    }
   }
 
   osSemaphoreRelease (lock_id);
@@ -38,6 +38,8 @@ from sdsio import (
     CMD_OPEN,
     CMD_PING,
     CMD_READ,
+    CMD_SEEK,
+    CMD_STATS,
     CMD_WRITE,
     SDSIO_VSI_VERSION,
     sdsio_manager,
@@ -239,7 +241,7 @@ atexit.register(shutdown)
 def processCOMMAND(command):
     global Data, Stream, STREAM_ID, ARGUMENT, FLAGS_SET, FLAGS_CLR
 
-    cmd = { 1: "CMD_OPEN", 2: "CMD_CLOSE", 3: "CMD_WRITE", 4: "CMD_READ", 5: "CMD_PING", 6: "CMD_FLAGS", 7: "CMD_INFO" }
+    cmd = { 1: "CMD_OPEN", 2: "CMD_CLOSE", 3: "CMD_WRITE", 4: "CMD_READ", 5: "CMD_PING", 6: "CMD_FLAGS", 7: "CMD_INFO", 8: "CMD_STATS", 9: "CMD_SEEK" }
 
     if not command in cmd:
         logger.error(f"ERROR:    Unknown COMMAND: {command}.")
@@ -283,6 +285,15 @@ def processCOMMAND(command):
             Stream.execute_request(_build_sdsio_request(CMD_INFO, sid=STREAM_ID, argument=ARGUMENT, data=Data))
             ARGUMENT = len(Data)
 
+        elif command == CMD_STATS:
+            Stream.execute_request(_build_sdsio_request(CMD_STATS, sid=STREAM_ID, data=Data[:ARGUMENT]))
+            ARGUMENT = 0
+
+        elif command == CMD_SEEK:
+            _resp = Stream.execute_request(_build_sdsio_request(CMD_SEEK, sid=STREAM_ID, argument=ARGUMENT))
+            _status = int.from_bytes(_resp[8:12], "little") if len(_resp) >= 12 else 1
+            ARGUMENT = 0 if _status == 0 else SDSIO_ERROR
+
     except Exception:
         logger.exception(f"ERROR:    Failed to process {cmd[command]}.")
         ARGUMENT = SDSIO_ERROR
@@ -15,6 +15,7 @@
 # limitations under the License.
 
 import asyncio
+import bisect
 import os
 import os.path as path
 import threading
@@ -44,8 +45,13 @@ CMD_READ        = 4
 CMD_PING        = 5
 CMD_FLAGS       = 6
 CMD_INFO        = 7
+CMD_STATS       = 8
+CMD_SEEK        = 9
 CMD_SYNC        = set(range(CMD_OPEN, CMD_PING + 1))    # commands with sid/arg/sz/data layout
-CMD_ALL         = set(range(CMD_OPEN, CMD_INFO + 1))    # all valid command IDs
+CMD_ALL         = set(range(CMD_OPEN, CMD_SEEK + 1))    # all valid command IDs
+
+# SDS stream statistics (sdsStats_t): number of 32-bit counters before the I/O time histogram
+STATS_HIST_OFFSET = 9
 
 # SDS Flags bit positions
 SDS_FLAG_MASK_START        = (1 << 31)
@@ -245,6 +251,7 @@ class sdsio_manager:
         self._read_buffers = {}      # sid -> ByteStreamBuffer
         self._read_threads = {}      # sid -> Thread
         self._read_stop = {}         # sid -> Event
+        self._read_index = {}        # sid -> record index (timeslots, positions), built on first seek
         # lock to protect stream_id increment and open checks
         self._manager_lock = threading.Lock()
         # timestamp of last stream read or write command
@@ -281,6 +288,7 @@ class sdsio_manager:
 
         self._info_flags: int = 0
         self._info_IdleRate: int = 0
+        self._stats_last: dict = {}
         self._last_async_time = time.time()
         self._last_playback_stream_name = None
         try:
@@ -453,14 +461,18 @@ class sdsio_manager:
         except Exception:
             logger.exception(f"Writer {sid} error.")
 
-    def _file_read_worker(self, sid, name, buf: ByteStreamBuffer, stop_evt):
+    def _file_read_worker(self, sid, name, buf: ByteStreamBuffer, stop_evt, start_idx=0, start_offset=0):
         _chunk_size = 128 * 1024
         try:
             _stream = self.opened_streams[sid]
             for _idx, _sds_file_path in enumerate(_stream.file_paths):
                 if stop_evt.is_set():
                     break
+                if _idx < start_idx:
+                    continue  # file before the seek position
                 with open(_sds_file_path, "rb") as _file_obj:
+                    if _idx == start_idx and start_offset:
+                        _file_obj.seek(start_offset)
                     while not stop_evt.is_set():
                         _data = _file_obj.read(_chunk_size)
                         if _data:
@@ -728,6 +740,7 @@ class sdsio_manager:
             self._read_buffers.pop(sid)
             self._read_threads.pop(sid)
             self._read_stop.pop(sid)
+            self._read_index.pop(sid, None)
         # unregister stream
         self.opened_streams.pop(sid, None)
 
@@ -820,6 +833,73 @@ class sdsio_manager:
         self.time_last_rw = time.time()
         return _resp
 
+    def _build_record_index(self, file_paths: list[str]):
+        # Parse record headers (timeslot, data size) of all files, data blocks are skipped
+        _timeslots = []
+        _positions = []     # (file index, offset of record header)
+        for _idx, _sds_file_path in enumerate(file_paths):
+            _size = os.path.getsize(_sds_file_path)
+            with open(_sds_file_path, "rb") as _f:
+                _offset = 0
+                while _offset + 8 <= _size:
+                    _f.seek(_offset)
+                    _header = _f.read(8)
+                    _timeslots.append(int.from_bytes(_header[0:4], 'little'))
+                    _positions.append((_idx, _offset))
+                    _offset += 8 + int.from_bytes(_header[4:8], 'little')
+        return _timeslots, _positions
+
+    def _seek(self, sid, timeslot):
+        _cmd = CMD_SEEK
+        _status = 1
+        _entry = self.opened_streams.get(sid)
+        if _entry and _entry.mode == 0 and sid in self._read_buffers and _entry.file_paths:
+            try:
+                # Find first record at or after timeslot (timeslots of a stream are increasing)
+                if sid not in self._read_index:
+                    self._read_index[sid] = self._build_record_index(_entry.file_paths)
+                _timeslots, _positions = self._read_index[sid]
+                _sizes = self._build_file_sizes(_entry.file_paths)
+                _i = bisect.bisect_left(_timeslots, timeslot)
+                if _i < len(_positions):
+                    _file_idx, _offset = _positions[_i]
+                else:
+                    # No record at or after timeslot: position to the end of the last file
+                    _file_idx = len(_sizes) - 1
+                    _offset = _sizes[_file_idx]
+
+                # Stop reader and restart it at the new position
+                self._read_stop[sid].set()
+                self._read_threads[sid].join()
+                _remaining = [0 if _n < _file_idx else (_sz - _offset if _n == _file_idx else _sz) for _n, _sz in enumerate(_sizes)]
+                self.opened_streams[sid] = _entry._replace(remaining_file_sizes=_remaining, file_idx=_file_idx)
+                _buf = ByteStreamBuffer()
+                _stop_evt = threading.Event()
+                _thr = threading.Thread(
+                    target=self._file_read_worker,
+                    args=(sid, _entry.name, _buf, _stop_evt, _file_idx, _offset),
+                    daemon=True
+                )
+                _thr.start()
+                self._read_buffers[sid] = _buf
+                self._read_threads[sid] = _thr
+                self._read_stop[sid]  = _stop_evt
+                logger.info(f"Seek:     {_entry.name} to timeslot {timeslot} ({self._format_path(_entry.file_paths[_file_idx])}, offset {_offset})")
+                _status = 0
+            except Exception:
+                logger.exception(f"Seek {sid} error.")
+        else:
+            logger.info(f"Not opened for read: {sid}.")
+
+        _resp = bytearray()
+        _resp.extend(_cmd.to_bytes(4,'little'))
+        _resp.extend(sid.to_bytes(4,'little'))
+        _resp.extend(_status.to_bytes(4,'little'))
+        _resp.extend((0).to_bytes(4,'little'))
+
+        self.time_last_rw = time.time()
+        return _resp
+
     def _pingServer(self, sid):
         _resp = bytearray()
         _cmd = CMD_PING
@@ -858,6 +938,32 @@ class sdsio_manager:
 
         return _resp
 
+    def _stats(self, sid: int, data: bytes):
+        # Print stream statistics (sdsStats_t), only when changed
+        _resp = bytearray()
+        _v = [int.from_bytes(data[i:i+4], 'little') for i in range(0, len(data) - 3, 4)]
+        if len(_v) < STATS_HIST_OFFSET:
+            logger.warning(f"Invalid stream statistics received (sid={sid}).")
+            return _resp
+        if self._stats_last.get(sid) == _v:
+            return _resp
+        self._stats_last[sid] = _v
+        _stream = self.opened_streams.get(sid)
+        _name = _stream.name if _stream else str(sid)
+        _bytes_in, _bytes_out, _records, _buf_size, _buf_max, _no_space, _no_data, _io_cnt, _io_time = _v[:STATS_HIST_OFFSET]
+        _fill = (100 * _buf_max // _buf_size) if _buf_size else 0
+        _io_avg = (_io_time // _io_cnt) if _io_cnt else 0
+        logger.info(f"Stream '{_name}': {_records} records, {_bytes_in} bytes in, {_bytes_out} bytes out, "
+                    f"buffer max {_buf_max}/{_buf_size} bytes ({_fill}%), no space {_no_space}, no data {_no_data}, "
+                    f"{_io_cnt} I/O transfers ({_io_avg} us avg).")
+        _hist = _v[STATS_HIST_OFFSET:]
+        if any(_hist):
+            _bins = ", ".join(f"<{2 << n} us: {c}" for n, c in enumerate(_hist[:-1]) if c)
+            if _hist[-1]:
+                _bins += (", " if _bins else "") + f">={1 << (len(_hist) - 1)} us: {_hist[-1]}"
+            logger.debug(f"Stream '{_name}' I/O time histogram: {_bins}.")
+        return _resp
+
     def clean(self):
         # close all open streams
         for _sid in list(self.opened_streams.keys()):
@@ -913,6 +1019,15 @@ class sdsio_manager:
             _err_len   = int.from_bytes(buf[12:16],'little')
             _err_data= buf[16:16+_err_len]
             return self._info(_flags, _idle_rate, _err_data)
+        elif _cmd == CMD_STATS:
+            _sid  = int.from_bytes(buf[4:8],'little')
+            _sz   = int.from_bytes(buf[12:16],'little')
+            _data = buf[16:16+_sz]
+            return self._stats(_sid, _data)
+        elif _cmd == CMD_SEEK:
+            _sid      = int.from_bytes(buf[4:8],'little')
+            _timeslot = int.from_bytes(buf[8:12],'little')
+            return self._seek(_sid, _timeslot)
 
         else:
             logger.error(f"=== FATAL ERROR === : Data integrity error - protocol mismatch. Restart the SDSIO-Client.")
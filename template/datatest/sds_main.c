@@ -47,8 +47,10 @@ static const char *SDS_MODE[] = { "recording", "playback" };
   \return       0 on success; -1 on error
 */
 int32_t OpenStreams (void) {
-  int32_t status = 0;
-  uint8_t play = 0U;
+  sdsOpenParam_t param[2];
+  sdsId_t        id[2];
+  int32_t        status = 0;
+  uint8_t        play = 0U;
 
   if ((sdsFlags & SDS_FLAG_PLAYBACK) != 0U) {   // If open for playback requested
     play = 1U;
@@ -57,16 +59,23 @@ int32_t OpenStreams (void) {
     ResetAlgorithm();
   }
 
-  // Open stream for playback or recording of input data, depending on the mode
-  if (play != 0U) {                             // -- Playback
-    // Check https://arm-software.github.io/SDS-Framework/main/theory.html#filenames for details on playback filename
-    sds_data_in_id = sdsOpen("Test_In", sdsModeRead, sds_data_in_buf, sizeof(sds_data_in_buf));
-  } else {                                      // -- Recording
-    sds_data_in_id = sdsOpen("Test_In", sdsModeWrite, sds_data_in_buf, sizeof(sds_data_in_buf));
-  }
-  // Open stream for recording of output data
-  if (sds_data_in_id != NULL) {
-    sds_data_out_id = sdsOpen("Test_Out", sdsModeWrite, sds_data_out_buf, sizeof(sds_data_out_buf));
+  // Stream for playback or recording of input data, depending on the mode
+  // Check https://arm-software.github.io/SDS-Framework/main/theory.html#filenames for details on playback filename
+  param[0].name     = "Test_In";
+  param[0].mode     = (play != 0U) ? sdsModeRead : sdsModeWrite;
+  param[0].buf      = sds_data_in_buf;
+  param[0].buf_size = sizeof(sds_data_in_buf);
+
+  // Stream for recording of output data
+  param[1].name     = "Test_Out";
+  param[1].mode     = sdsModeWrite;
+  param[1].buf      = sds_data_out_buf;
+  param[1].buf_size = sizeof(sds_data_out_buf);
+
+  // Open streams (input stream buffer is filled for playback while the output stream is opened)
+  if (sdsOpenGroup(param, id, 2U) == SDS_OK) {
+    sds_data_in_id  = id[0];
+    sds_data_out_id = id[1];
   }
 
   SDS_ASSERT(sds_data_in_id  != NULL);
@@ -162,9 +171,8 @@ __NO_RETURN void AlgorithmThread (void *argument) {
 
       // Read input data from playback stream
       do {
-        ret = sdsRead(sds_data_in_id, &timeslot, algo_data_in_buf, sizeof(algo_data_in_buf));
+        ret = sdsReadTimeout(sds_data_in_id, &timeslot, algo_data_in_buf, sizeof(algo_data_in_buf), 10U);
         if (ret == SDS_NO_DATA) {
-          osDelay(10U);
           DiscardInputData();
         }
       } while (ret == SDS_NO_DATA);
@@ -188,10 +196,7 @@ __NO_RETURN void AlgorithmThread (void *argument) {
 
         // Record algorithm input data
         do {
-          ret = sdsWrite(sds_data_in_id, timeslot, algo_data_in_buf, sizeof(algo_data_in_buf));
-          if (ret == SDS_NO_SPACE) {
-            osDelay(10U);
-          }
+          ret = sdsWriteTimeout(sds_data_in_id, timeslot, algo_data_in_buf, sizeof(algo_data_in_buf), 100U);
         } while (ret == SDS_NO_SPACE);
         SDS_ASSERT(ret == sizeof(algo_data_in_buf));
       }
@@ -206,10 +211,7 @@ __NO_RETURN void AlgorithmThread (void *argument) {
     if (sds_state == SDS_STATE_ACTIVE) {
       // Record algorithm output data
       do {
-        ret = sdsWrite(sds_data_out_id, timeslot, algo_data_out_buf, sizeof(algo_data_out_buf));
-        if (ret == SDS_NO_SPACE) {
-          osDelay(10U);
-        }
+        ret = sdsWriteTimeout(sds_data_out_id, timeslot, algo_data_out_buf, sizeof(algo_data_out_buf), 100U);
       } while (ret == SDS_NO_SPACE);
       SDS_ASSERT(ret == sizeof(algo_data_out_buf));
     }
@@ -15,6 +15,7 @@
 # limitations under the License.
 
 import argparse
+import bisect
 import sys
 import os
 import os.path as path
@@ -57,8 +58,136 @@ CMD_READ        = 4
 CMD_PING        = 5
 CMD_FLAGS       = 6
 CMD_INFO        = 7
+CMD_STATS       = 8
+CMD_SEEK        = 9
+CMD_CREDIT      = 10
 CMD_SYNC        = set(range(CMD_OPEN, CMD_PING + 1))    # commands with sid/arg/sz/data layout
-CMD_ALL         = set(range(CMD_OPEN, CMD_INFO + 1))    # all valid command IDs
+CMD_ALL         = set(range(CMD_OPEN, CMD_CREDIT + 1))  # all valid command IDs
+
+# SDSIO protocol version (major << 16 | minor) and features exchanged with CMD_PING (capability data)
+SDSIO_PROTOCOL_VERSION  = 0x00010000
+FEATURE_TAGS            = 1 << 0    # request tags
+FEATURE_READ_STREAMING  = 1 << 1    # streaming read mode (CMD_CREDIT)
+FEATURE_SEEK            = 1 << 2    # seek in read streams (CMD_SEEK)
+FEATURE_STATS           = 1 << 3    # stream statistics (CMD_STATS)
+FEATURE_CODEC           = 1 << 4    # payload codec of write streams
+SERVER_FEATURES         = FEATURE_TAGS | FEATURE_READ_STREAMING | FEATURE_SEEK | FEATURE_STATS | FEATURE_CODEC
+
+# Default maximum frame size (data size of one command or response), transports with smaller frames set their own
+MAX_FRAME_SIZE          = 64 * 1024
+
+# SDSIO payload codec (codec identifier: bits 0..3 = type, bits 4..7 = parameter)
+CODEC_TYPE_MASK    = 0x0F
+CODEC_TYPE_DELTA16 = 0x01   # delta-varint coding of 16-bit samples, parameter = number of interleaved channels - 1
+CODEC_SUPPORTED    = {CODEC_TYPE_DELTA16}
+
+CODEC_HEAD_SIZE    = 8      # SDS record header (timeslot, data size) in the stream data
+
+class CodecState:
+    # Codec state of a write stream (see sdsio_codec.c), carried across SDSIO_CMD_WRITE commands.
+    # Record headers are copied, record data is coded as 16-bit samples starting with channel 0 in each record.
+    def __init__(self, codec):
+        self.codec = codec
+        self.channels = ((codec >> 4) & 0x0F) + 1
+        self.prev = [0] * self.channels
+        self.ch = 0
+        self.head_cnt = 0
+        self.rec_left = 0
+        self.odd = 0                # low byte of a sample: 0 = none, 2 = copied at end of command
+        self.low = 0
+
+    def _head(self, byte):
+        if self.head_cnt >= 4:
+            self.rec_left |= byte << (8 * (self.head_cnt - 4))
+        self.head_cnt += 1
+        if self.head_cnt == CODEC_HEAD_SIZE and self.rec_left == 0:
+            self.head_cnt = 0
+
+    def _sample(self, sample):
+        self.prev[self.ch] = sample
+        self.ch = self.ch + 1 if self.ch + 1 < self.channels else 0
+
+    def _data(self, cnt=1):
+        self.rec_left -= cnt
+        if self.rec_left == 0:
+            self.head_cnt = 0
+            self.ch = 0
+
+    def track(self, data):
+        # Update the state with data which is sent as is (as sdsioCodecEncode and sdsioCodecEncodeEnd)
+        for _byte in data:
+            if self.head_cnt < CODEC_HEAD_SIZE:
+                self._head(_byte)
+            elif self.odd == 0:
+                if self.rec_left != 1:
+                    self.low = _byte
+                    self.odd = 1
+                self._data()
+            else:
+                self.odd = 0
+                self._sample(self.low | (_byte << 8))
+                self._data()
+        if self.odd == 1:
+            self.odd = 2
+
+    def decode(self, data, size):
+        # Decode the payload of a SDSIO_CMD_WRITE command, returns None on invalid data
+        if (self.codec & CODEC_TYPE_MASK) != CODEC_TYPE_DELTA16:
+            return None
+        _out = bytearray(size)
+        _num = 0
+        _pos = 0
+        _in_size = len(data)
+        while _pos < size:
+            if _num == _in_size:
+                return None
+            if self.head_cnt < CODEC_HEAD_SIZE:
+                self._head(data[_num])
+                _out[_pos] = data[_num]
+                _pos += 1
+                _num += 1
+                continue
+            if self.odd == 2:
+                _out[_pos] = data[_num]
+                self.odd = 0
+                self._sample(self.low | (data[_num] << 8))
+                self._data()
+                _pos += 1
+                _num += 1
+                continue
+            if self.rec_left == 1 or size - _pos == 1:
+                # trailing odd byte of the record data or low byte of a sample split between commands
+                if self.rec_left != 1:
+                    self.low = data[_num]
+                    self.odd = 2
+                _out[_pos] = data[_num]
+                self._data()
+                _pos += 1
+                _num += 1
+                continue
+            _zz = 0
+            _shift = 0
+            while True:
+                if _num == _in_size or _shift > 14:
+                    return None
+                _byte = data[_num]
+                _num += 1
+                _zz |= (_byte & 0x7F) << _shift
+                _shift += 7
+                if not _byte & 0x80:
+                    break
+            _sample = (self.prev[self.ch] + ((_zz >> 1) ^ -(_zz & 1))) & 0xFFFF
+            self._sample(_sample)
+            _out[_pos] = _sample & 0xFF
+            _out[_pos + 1] = _sample >> 8
+            _pos += 2
+            self._data(2)
+        if _num != _in_size:
+            return None
+        return _out
+
+# SDS stream statistics (sdsStats_t): number of 32-bit counters before the I/O time histogram
+STATS_HIST_OFFSET = 9
 
 # SDSIO monitor commands and  messages
 SDSIO_MON_OPEN        = 1
@@ -651,10 +780,18 @@ class sdsio_manager:
         self._write_buffers = {}     # sid -> ByteStreamBuffer
         self._write_threads = {}     # sid -> Thread
         self._write_stop = {}        # sid -> Event
+        self._write_codec = {}       # sid -> CodecState (write streams with payload codec)
         # read side
         self._read_buffers = {}      # sid -> ByteStreamBuffer
         self._read_threads = {}      # sid -> Thread
         self._read_stop = {}         # sid -> Event
+        self._read_index = {}        # sid -> record index (timeslots, positions), built on first seek
+        self._read_credit = {}       # sid -> bytes granted by the client for pushed data (streaming read mode)
+        self._read_push_eos = set()  # sids for which end of stream has been pushed
+        self._read_pending = {}      # sid -> (tag, size, deadline) of a tagged read waiting for data
+        # frame size: maximum of the transport and negotiated with CMD_PING (0 = not negotiated)
+        self.max_frame_size = MAX_FRAME_SIZE
+        self._frame_size = 0
         # lock to protect stream_id increment and open checks
         self._manager_lock = threading.Lock()
         # timestamp of last stream read or write command
@@ -691,6 +828,7 @@ class sdsio_manager:
 
         self._info_flags: int = 0
         self._info_IdleRate: int = 0
+        self._stats_last: dict = {}
         self._last_async_time = time.time()
         self._last_playback_stream_name = None
         try:
@@ -863,14 +1001,18 @@ class sdsio_manager:
         except Exception:
             logger.exception(f"Writer {sid} error.")
 
-    def _file_read_worker(self, sid, name, buf: ByteStreamBuffer, stop_evt):
+    def _file_read_worker(self, sid, name, buf: ByteStreamBuffer, stop_evt, start_idx=0, start_offset=0):
         _chunk_size = 128 * 1024
         try:
             _stream = self.opened_streams[sid]
             for _idx, _sds_file_path in enumerate(_stream.file_paths):
                 if stop_evt.is_set():
                     break
+                if _idx < start_idx:
+                    continue  # file before the seek position
                 with open(_sds_file_path, "rb") as _file_obj:
+                    if _idx == start_idx and start_offset:
+                        _file_obj.seek(start_offset)
                     while not stop_evt.is_set():
                         _data = _file_obj.read(_chunk_size)
                         if _data:
@@ -926,7 +1068,7 @@ class sdsio_manager:
         self.shutdown_requested.set()
         if self._loop and self._main_task:
             self._loop.call_soon_threadsafe(self._main_task.cancel)
-    def _open(self, mode, name):
+    def _open(self, mode, name, codec=0):
         _cmd = CMD_OPEN
         # prepare error response
         _resp_err = bytearray()
@@ -1091,11 +1233,19 @@ class sdsio_manager:
                     self._monitor.send_open_msg(_file_paths[0], 0)
             self._last_playback_stream_name = name
 
+        # accept requested payload codec for write streams (returned in bits 8..15 of the mode)
+        if mode == 1 and (codec & CODEC_TYPE_MASK) in CODEC_SUPPORTED:
+            logger.debug(f"Stream '{name}': payload codec 0x{codec:02X}")
+            _mode = mode | ((codec & 0xFF) << 8)
+            self._write_codec[_sid] = CodecState(codec & 0xFF)
+        else:
+            _mode = mode
+
         # build success response
         _resp = bytearray()
         _resp.extend(_cmd.to_bytes(4,'little'))
         _resp.extend(_sid.to_bytes(4,'little'))
-        _resp.extend(mode.to_bytes(4,'little'))
+        _resp.extend(_mode.to_bytes(4,'little'))
         _resp.extend((0).to_bytes(4,'little'))
 
         return _resp
@@ -1106,6 +1256,7 @@ class sdsio_manager:
         _name = _stream.name
 
         # clean up writer side
+        self._write_codec.pop(sid, None)
         if sid in self._write_buffers:
             _buf = self._write_buffers.pop(sid)
             _buf.set_eof()
@@ -1138,6 +1289,10 @@ class sdsio_manager:
             self._read_buffers.pop(sid)
             self._read_threads.pop(sid)
             self._read_stop.pop(sid)
+            self._read_index.pop(sid, None)
+            self._read_credit.pop(sid, None)
+            self._read_push_eos.discard(sid)
+            self._read_pending.pop(sid, None)
         # unregister stream
         self.opened_streams.pop(sid, None)
 
@@ -1150,35 +1305,79 @@ class sdsio_manager:
 
         return _resp
 
-    def _write(self, sid, data):
+    def _write(self, sid, data, arg=0):
         _resp = bytearray()
         _buf = self._write_buffers.get(sid)
         if not _buf:
             logger.info(f"Not opened for write: {sid}.")
             return _resp
+        _codec = self._write_codec.get(sid)
+        if arg & 0xFF:
+            # encoded data: argument = codec | (size of decoded data << 8)
+            _data = _codec.decode(data, arg >> 8) if _codec and _codec.codec == (arg & 0xFF) else None
+            if _data is None:
+                logger.error(f"Invalid encoded data (codec 0x{arg & 0xFF:02X}), stream {sid}: {len(data)} bytes discarded.")
+                return _resp
+            data = _data
+        elif _codec:
+            # data of a stream with payload codec sent as is
+            _codec.track(data)
         _buf.write(data)
 
         self.time_last_rw = time.time()
         return _resp
 
-    def _read(self, sid, size):
-        _resp = bytearray()
-        _cmd = CMD_READ
-        _eof = 0
-        _data = bytearray()
+    def _read(self, sid, size, tag=0):
         _entry = self.opened_streams.get(sid)
         # invalid read
         if not _entry or _entry.mode != 0:
-            _resp.extend(_cmd.to_bytes(4,'little'))
-            _resp.extend(sid.to_bytes(4,'little'))
-            _resp.extend((0).to_bytes(4,'little'))
-            _resp.extend((0).to_bytes(4,'little'))
-            return _resp
+            return self._read_response(sid, tag, 0, b'')
 
         _buf = self._read_buffers.get(sid)
-        # read until requested size or EOF
+        if tag != 0:
+            # Tagged read: respond with the data which is available, defer the response when there is none
+            # (responses of other requests are not blocked while the file is read)
+            _buf_eof = _buf.eof
+            _data = self._read_data(sid, size, timeout=0)
+            if not _data and not _buf_eof:
+                self._read_pending[sid] = (tag, size, time.time() + 0.05)
+                return bytearray()
+        else:
+            # read until requested size or EOF
+            _data = self._read_data(sid, size, timeout=0.05)
+            _buf_eof = _buf.eof
+        return self._read_response(sid, tag, 1 if (not _data and _buf_eof) else 0, _data)
+
+    def _read_response(self, sid, tag, eof, data):
+        _resp = bytearray()
+        _cmd = CMD_READ
+        _resp.extend(_cmd.to_bytes(2,'little'))
+        _resp.extend(tag.to_bytes(2,'little'))
+        _resp.extend(sid.to_bytes(4,'little'))
+        _resp.extend(eof.to_bytes(4,'little'))
+        _resp.extend(len(data).to_bytes(4,'little'))
+        if data:
+            _resp.extend(data)
+
+        self.time_last_rw = time.time()
+        return _resp
+
+    def _read_complete(self, sid, force=False):
+        # Complete a deferred tagged read when data or EOF is available, on timeout or when forced
+        _tag, _size, _deadline = self._read_pending[sid]
+        _buf_eof = self._read_buffers[sid].eof
+        _data = b'' if force else self._read_data(sid, _size, timeout=0)
+        if not _data and not _buf_eof and not force and time.time() < _deadline:
+            return bytearray()
+        self._read_pending.pop(sid)
+        return self._read_response(sid, _tag, 1 if (not _data and _buf_eof and not force) else 0, _data)
+
+    def _read_data(self, sid, size, timeout):
+        # Read up to size bytes from the stream read buffer, wait up to timeout for each chunk
+        _data = bytearray()
+        _buf = self._read_buffers.get(sid)
         while len(_data) < size:
-            _chunk = _buf.read(size - len(_data), timeout=0.05)
+            _chunk = _buf.read(size - len(_data), timeout=timeout)
             if not _chunk:
                 break
             _data.extend(_chunk)
@@ -1218,9 +1417,26 @@ class sdsio_manager:
                                     self._monitor.send_open_msg(_sds_file_path, 0)
                             continue
                         break
-        if not _data and _buf.eof:
+        return _data
+
+    def _push(self, sid):
+        # Push data of a stream in streaming read mode within the credit granted by the client
+        _resp = bytearray()
+        _credit = self._read_credit.get(sid, 0)
+        if _credit == 0 or sid in self._read_push_eos:
+            return _resp
+        _eof = 0
+        # EOF is checked before reading: data written before EOF is set is pushed first
+        _buf_eof = self._read_buffers[sid].eof
+        _size = min(_credit, self._frame_size) if self._frame_size else _credit
+        _data = self._read_data(sid, _size, timeout=0)
+        if not _data:
+            if not _buf_eof:
+                return _resp
             _eof = 1
-        _resp.extend(_cmd.to_bytes(4,'little'))
+            self._read_push_eos.add(sid)
+        self._read_credit[sid] = _credit - len(_data)
+        _resp.extend(CMD_CREDIT.to_bytes(4,'little'))
         _resp.extend(sid.to_bytes(4,'little'))
         _resp.extend(_eof.to_bytes(4,'little'))
         _resp.extend(len(_data).to_bytes(4,'little'))
@@ -1230,6 +1446,90 @@ class sdsio_manager:
         self.time_last_rw = time.time()
         return _resp
 
+    def _credit(self, sid, size):
+        _entry = self.opened_streams.get(sid)
+        if not _entry or _entry.mode != 0 or sid not in self._read_buffers:
+            logger.info(f"Not opened for read: {sid}.")
+            return bytearray()
+        # Increase credit and push data which is already available
+        self._read_credit[sid] = self._read_credit.get(sid, 0) + size
+        return self._push(sid)
+
+    def _build_record_index(self, file_paths: list[str]):
+        # Parse record headers (timeslot, data size) of all files, data blocks are skipped
+        _timeslots = []
+        _positions = []     # (file index, offset of record header)
+        for _idx, _sds_file_path in enumerate(file_paths):
+            _size = os.path.getsize(_sds_file_path)
+            with open(_sds_file_path, "rb") as _f:
+                _offset = 0
+                while _offset + 8 <= _size:
+                    _f.seek(_offset)
+                    _header = _f.read(8)
+                    _timeslots.append(int.from_bytes(_header[0:4], 'little'))
+                    _positions.append((_idx, _offset))
+                    _offset += 8 + int.from_bytes(_header[4:8], 'little')
+        return _timeslots, _positions
+
+    def _seek(self, sid, timeslot, tag=0):
+        _cmd = CMD_SEEK
+        _status = 1
+        _entry = self.opened_streams.get(sid)
+        _resp = bytearray()
+        # Deferred read is completed without data before the position changes
+        if sid in self._read_pending:
+            _resp.extend(self._read_complete(sid, force=True))
+        # Streaming read mode: the client discards pushed data and grants new credit after seek
+        if sid in self._read_credit:
+            self._read_credit[sid] = 0
+        self._read_push_eos.discard(sid)
+        if _entry and _entry.mode == 0 and sid in self._read_buffers and _entry.file_paths:
+            try:
+                # Find first record at or after timeslot (timeslots of a stream are increasing)
+                if sid not in self._read_index:
+                    self._read_index[sid] = self._build_record_index(_entry.file_paths)
+                _timeslots, _positions = self._read_index[sid]
+                _sizes = self._build_file_sizes(_entry.file_paths)
+                _i = bisect.bisect_left(_timeslots, timeslot)
+                if _i < len(_positions):
+                    _file_idx, _offset = _positions[_i]
+                else:
+                    # No record at or after timeslot: position to the end of the last file
+                    _file_idx = len(_sizes) - 1
+                    _offset = _sizes[_file_idx]
+
+                # Stop reader and restart it at the new position
+                self._read_stop[sid].set()
+                self._read_threads[sid].join()
+                _remaining = [0 if _n < _file_idx else (_sz - _offset if _n == _file_idx else _sz) for _n, _sz in enumerate(_sizes)]
+                self.opened_streams[sid] = _entry._replace(remaining_file_sizes=_remaining, file_idx=_file_idx)
+                _buf = ByteStreamBuffer()
+                _stop_evt = threading.Event()
+                _thr = threading.Thread(
+                    target=self._file_read_worker,
+                    args=(sid, _entry.name, _buf, _stop_evt, _file_idx, _offset),
+                    daemon=True
+                )
+                _thr.start()
+                self._read_buffers[sid] = _buf
+                self._read_threads[sid] = _thr
+                self._read_stop[sid]  = _stop_evt
+                logger.info(f"Seek:     {_entry.name} to timeslot {timeslot} ({self._format_path(_entry.file_paths[_file_idx])}, offset {_offset})")
+                _status = 0
+            except Exception:
+                logger.exception(f"Seek {sid} error.")
+        else:
+            logger.info(f"Not opened for read: {sid}.")
+
+        _resp.extend(_cmd.to_bytes(2,'little'))
+        _resp.extend(tag.to_bytes(2,'little'))
+        _resp.extend(sid.to_bytes(4,'little'))
+        _resp.extend(_status.to_bytes(4,'little'))
+        _resp.extend((0).to_bytes(4,'little'))
+
+        self.time_last_rw = time.time()
+        return _resp
+
     def _pingServer(self, sid):
         _resp = bytearray()
         _cmd = CMD_PING
@@ -1268,10 +1568,38 @@ class sdsio_manager:
 
         return _resp
 
+    def _stats(self, sid: int, data: bytes):
+        # Print stream statistics (sdsStats_t), only when changed
+        _resp = bytearray()
+        _v = [int.from_bytes(data[i:i+4], 'little') for i in range(0, len(data) - 3, 4)]
+        if len(_v) < STATS_HIST_OFFSET:
+            logger.warning(f"Invalid stream statistics received (sid={sid}).")
+            return _resp
+        if self._stats_last.get(sid) == _v:
+            return _resp
+        self._stats_last[sid] = _v
+        _stream = self.opened_streams.get(sid)
+        _name = _stream.name if _stream else str(sid)
+        _bytes_in, _bytes_out, _records, _buf_size, _buf_max, _no_space, _no_data, _io_cnt, _io_time = _v[:STATS_HIST_OFFSET]
+        _fill = (100 * _buf_max // _buf_size) if _buf_size else 0
+        _io_avg = (_io_time // _io_cnt) if _io_cnt else 0
+        logger.info(f"Stream '{_name}': {_records} records, {_bytes_in} bytes in, {_bytes_out} bytes out, "
+                    f"buffer max {_buf_max}/{_buf_size} bytes ({_fill}%), no space {_no_space}, no data {_no_data}, "
+                    f"{_io_cnt} I/O transfers ({_io_avg} us avg).")
+        _hist = _v[STATS_HIST_OFFSET:]
+        if any(_hist):
+            _bins = ", ".join(f"<{2 << n} us: {c}" for n, c in enumerate(_hist[:-1]) if c)
+            if _hist[-1]:
+                _bins += (", " if _bins else "") + f">={1 << (len(_hist) - 1)} us: {_hist[-1]}"
+            logger.debug(f"Stream '{_name}' I/O time histogram: {_bins}.")
+        return _resp
+
     def clean(self):
         # close all open streams
         for _sid in list(self.opened_streams.keys()):
             self._close(_sid)
+        # negotiated frame size is kept: a reconnecting SDSIO-Client does not repeat the capability exchange
+        # (a new SDSIO-Client negotiates it again with CMD_PING)
 
     def _get_async_flags(self):
         _resp = bytearray()
@@ -1284,12 +1612,53 @@ class sdsio_manager:
         _resp.extend((0).to_bytes(4,'little'))
         return _resp
 
+    def _get_async_push(self):
+        _resp = bytearray()
+        for _sid in list(self._read_credit):
+            _resp.extend(self._push(_sid))
+        for _sid in list(self._read_pending):
+            _resp.extend(self._read_complete(_sid))
+        return _resp
+
     def get_async_response(self):
+        _resp = bytearray()
         _now = time.time()
         if _now - self._last_async_time >= 0.1:
             self._last_async_time = _now
-            return self._get_async_flags()
-        return None
+            _resp.extend(self._get_async_flags())
+        # Data of streams in streaming read mode and deferred tagged reads
+        _resp.extend(self._get_async_push())
+        return _resp if _resp else None
+
+    def push_pending(self):
+        # True when a stream in streaming read mode has credit or a tagged read is deferred
+        # (data is sent as soon as it is available)
+        if self._read_pending:
+            return True
+        return any(_credit > 0 and _sid not in self._read_push_eos for _sid, _credit in self._read_credit.items())
+
+    def _capabilities(self, version, frame_size, data):
+        # Capability exchange (CMD_PING with data): frame size is the smaller of client and transport maximum
+        _features = int.from_bytes(data[0:4],'little')
+        _codecs   = int.from_bytes(data[4:8],'little')
+        self._frame_size = min(frame_size, self.max_frame_size) if frame_size else self.max_frame_size
+        logger.debug(f"SDSIO-Client: protocol {version >> 16}.{version & 0xFFFF}, frame size {self._frame_size} bytes, "
+                     f"features 0x{_features:08X}, codecs 0x{_codecs:08X}.")
+        _codecs_supported = sum(1 << _type for _type in CODEC_SUPPORTED)
+        _resp = bytearray()
+        _resp.extend(CMD_PING.to_bytes(4,'little'))
+        _resp.extend(SDSIO_PROTOCOL_VERSION.to_bytes(4,'little'))
+        _resp.extend(self._frame_size.to_bytes(4,'little'))
+        _resp.extend((8).to_bytes(4,'little'))
+        _resp.extend(SERVER_FEATURES.to_bytes(4,'little'))
+        _resp.extend(_codecs_supported.to_bytes(4,'little'))
+        return _resp
+
+    def _set_tag(self, resp, tag):
+        # Response to a tagged request carries the request tag (upper 16 bits of the command)
+        if resp and tag != 0:
+            resp[2:4] = tag.to_bytes(2,'little')
+        return resp
 
     def get_shutdown_flags(self):
         _resp = bytearray()
@@ -1306,23 +1675,40 @@ class sdsio_manager:
         return _resp
 
     def execute_request(self, buf: bytes):
-        _cmd = int.from_bytes(buf[0:4],'little')
+        # Command in lower 16 bits, request tag in upper 16 bits (0 = untagged)
+        _cmd = int.from_bytes(buf[0:2],'little')
+        _tag = int.from_bytes(buf[2:4],'little')
         if _cmd in CMD_SYNC:
             _sid = int.from_bytes(buf[4:8],'little')
             _arg = int.from_bytes(buf[8:12],'little')
             _sz  = int.from_bytes(buf[12:16],'little')
             _data= buf[16:16+_sz]
-            if   _cmd == CMD_OPEN:  return self._open(_arg, _data.decode('utf-8').rstrip('\0'))
+            if   _cmd == CMD_OPEN:  return self._set_tag(self._open(_arg, _data.decode('utf-8').rstrip('\0'), _sid), _tag)
             elif _cmd == CMD_CLOSE: return self._close(_sid)
-            elif _cmd == CMD_WRITE: return self._write(_sid, _data)
-            elif _cmd == CMD_READ:  return self._read(_sid, _arg)
-            elif _cmd == CMD_PING:  return self._pingServer(_sid)
+            elif _cmd == CMD_WRITE: return self._write(_sid, _data, _arg)
+            elif _cmd == CMD_READ:  return self._read(_sid, _arg, _tag)
+            elif _cmd == CMD_PING and _sz >= 8:
+                return self._set_tag(self._capabilities(_sid, _arg, _data), _tag)
+            elif _cmd == CMD_PING:  return self._set_tag(self._pingServer(_sid), _tag)
         elif _cmd == CMD_INFO:
             _flags     = int.from_bytes(buf[4:8],'little')
             _idle_rate = int.from_bytes(buf[8:12],'little')
             _err_len   = int.from_bytes(buf[12:16],'little')
             _err_data= buf[16:16+_err_len]
             return self._info(_flags, _idle_rate, _err_data)
+        elif _cmd == CMD_STATS:
+            _sid  = int.from_bytes(buf[4:8],'little')
+            _sz   = int.from_bytes(buf[12:16],'little')
+            _data = buf[16:16+_sz]
+            return self._stats(_sid, _data)
+        elif _cmd == CMD_SEEK:
+            _sid      = int.from_bytes(buf[4:8],'little')
+            _timeslot = int.from_bytes(buf[8:12],'little')
+            return self._seek(_sid, _timeslot, _tag)
+        elif _cmd == CMD_CREDIT:
+            _sid  = int.from_bytes(buf[4:8],'little')
+            _size = int.from_bytes(buf[8:12],'little')
+            return self._credit(_sid, _size)
 
         else:
             logger.error(f"=== FATAL ERROR === : Data integrity error - protocol mismatch. Restart the SDSIO-Client.")
@@ -1378,20 +1764,21 @@ class async_sdsio_server_socket:
         try:
             logger.info("SDSIO-Client connected.")
             while True:
-                # Send async FLAGS response periodically
+                # Send async FLAGS response periodically and data of streams in streaming read mode
                 _resp = self._manager.get_async_response()
                 if _resp:
                     writer.write(_resp)
                     await writer.drain()
 
                 try:
-                    # read fixed-size header, then payload, with a timeout
-                    _hdr = await asyncio.wait_for(reader.readexactly(16), timeout=0.1)
+                    # read fixed-size header, then payload, with a timeout (short while data is pushed)
+                    _timeout = 0.001 if self._manager.push_pending() else 0.1
+                    _hdr = await asyncio.wait_for(reader.readexactly(16), timeout=_timeout)
                 except asyncio.TimeoutError:
-                    continue # No data from client, loop to check for FLAGS send
+                    continue # No data from client, loop to check for FLAGS and pushed data send
 
                 # validate command before reading payload
-                _cmd = int.from_bytes(_hdr[0:4],'little')
+                _cmd = int.from_bytes(_hdr[0:2],'little')
                 if _cmd not in CMD_ALL:
                     logger.error(f"=== FATAL ERROR === : Data integrity error - protocol mismatch. Restart the SDSIO-Client.")
                     logger.info("Closing SDSIO-Client connection...")
@@ -1530,6 +1917,7 @@ async def sdsio_server_socket_run_supervised(ip, port, connect_mode, connect_mes
 #                           Blocking Serial Server                             #
 # ---------------------------------------------------------------------------- #
 class sdsio_server_serial:
+    _MAX_FRAME_SIZE = 8 * 1024  # larger frames bring no gain at UART data rates
     def __init__(self, port, baudrate, parity, stop_bits, connect_timeout, manager: sdsio_manager):
         self._port = port
         self._baudrate = baudrate
@@ -1537,6 +1925,7 @@ class sdsio_server_serial:
         self._stop_bits = stop_bits
         self._connect_timeout = connect_timeout
         self._manager = manager
+        self._manager.max_frame_size = self._MAX_FRAME_SIZE
         self._ser = None
 
     def _open(self):
@@ -1600,7 +1989,7 @@ class sdsio_server_serial:
 
         try:
             while not self._manager.shutdown_requested.is_set():
-                # Send async FLAGS response periodically
+                # Send async FLAGS response periodically and data of streams in streaming read mode
                 _resp = self._manager.get_async_response()
                 if _resp:
                     self._write(_resp)
@@ -1617,7 +2006,7 @@ class sdsio_server_serial:
                     _header = _buffer[:16]
 
                     # validate command before reading payload
-                    _cmd = int.from_bytes(_header[0:4], 'little')
+                    _cmd = int.from_bytes(_header[0:2], 'little')
                     if _cmd not in CMD_ALL:
                         logger.error(f"=== FATAL ERROR === : Data integrity error - protocol mismatch. Restart the SDSIO-Client.")
                         _buffer.clear()
@@ -1868,22 +2257,23 @@ class sdsio_server_usb:
 
     async def _consumer(self):
         while self._running:
-            # Send async FLAGS response periodically
+            # Send async FLAGS response periodically and data of streams in streaming read mode
             _resp = self._mgr.get_async_response()
             if _resp:
                 await self._out_q.put(_resp)
 
             try:
-                _data = await asyncio.wait_for(self._in_q.get(), timeout=0.1)
+                _timeout = 0.001 if self._mgr.push_pending() else 0.1
+                _data = await asyncio.wait_for(self._in_q.get(), timeout=_timeout)
             except asyncio.TimeoutError:
-                continue  # No data from device, loop to check for FLAGS send
+                continue  # No data from device, loop to check for FLAGS and pushed data send
 
             self._rx_buf.extend(_data)
             while len(self._rx_buf) >= 16:
                 _hdr   = self._rx_buf[:16]
 
                 # validate command before reading payload
-                _cmd = int.from_bytes(_hdr[0:4],'little')
+                _cmd = int.from_bytes(_hdr[0:2],'little')
                 if _cmd not in CMD_ALL:
                     logger.error(f"=== FATAL ERROR === : Data integrity error - protocol mismatch. Restart the SDSIO-Client.")
                     self._protocol_error = True